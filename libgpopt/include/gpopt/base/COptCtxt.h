@@ -13,6 +13,7 @@
 #define GPOPT_COptCtxt_H
 
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/task/CTaskLocalStorageObject.h"
 
 #include "gpopt/base/CColumnFactory.h"
@@ -102,6 +103,9 @@ namespace gpopt
 			// does the query have replicated tables
 			BOOL m_has_replicated_tables;
 
+			// wall clock started when optimization starts
+			CWallClock m_clockOptimization;
+
 		public:
 
 			// ctor
@@ -130,6 +134,12 @@ namespace gpopt
 				return m_optimizer_config;
 			}
 
+			// is optimization bounded by the configured budget
+			BOOL FBudgeted() const;
+
+			// has optimization exceeded the configured budget
+			BOOL FBudgetExceeded() const;
+
 			// are we optimizing a DML query
 			BOOL FDMLQuery() const
 			{
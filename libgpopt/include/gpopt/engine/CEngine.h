@@ -34,6 +34,7 @@ namespace gpopt
 	class CReqdPropPlan;
 	class CReqdPropRelational;
 	class CEnumeratorConfig;
+	class CSchedulerConfig;
 
 	//---------------------------------------------------------------------------
 	//	@class:
@@ -86,6 +87,12 @@ namespace gpopt
 			// mutex for locking shared data structures when updating optimization statistics
 			CMutex m_mutexOptStats;
 
+			// is optimization time bounded by a budget
+			BOOL m_fBudgeted;
+
+			// has the budget run out after a complete plan was found
+			BOOL m_fBudgetExhausted;
+
 #ifdef GPOS_DEBUG
 
 			// a set of internal debugging function used for recursive
@@ -167,10 +174,10 @@ namespace gpopt
 			void ScheduleMainJob(CSchedulerContext *psc, COptimizationContext *poc);
 
 			// build memo using multiple threads
-			void MultiThreadedOptimize(ULONG ulWorkers = 4);
+			void MultiThreadedOptimize(const CSchedulerConfig *psched_conf);
 
 			// run optimizer on the main thread
-			void MainThreadOptimize();
+			void MainThreadOptimize(const CSchedulerConfig *psched_conf);
 
 			// print activated xform
 			void PrintActivatedXforms(IOstream &os) const;
@@ -181,10 +188,14 @@ namespace gpopt
 			// check if search has terminated
 			BOOL FSearchTerminated() const
 			{
-				// at least one stage has completed and achieved required cost
-				return (NULL != PssPrevious() && PssPrevious()->FAchievedReqdCost());
+				// at least one stage has completed and achieved required cost,
+				// or the optimization budget ran out
+				return (NULL != PssPrevious() && PssPrevious()->FAchievedReqdCost()) || m_fBudgetExhausted;
 			}
 
+			// check if a complete plan has been found for the root group
+			BOOL FPlanFound();
+
 			// generate random plan id
 			ULLONG UllRandomPlanId(ULONG *seed);
 
@@ -376,6 +387,11 @@ namespace gpopt
 				return (*m_search_stage_array)[m_ulCurrSearchStage];
 			}
 
+			// check if optimization jobs should stop, either since current
+			// search stage timed out, or since the optimization budget ran
+			// out and a complete plan has been found
+			BOOL FStopSearch();
+
 			// current search stage index accessor
 			ULONG UlCurrSearchStage() const
 			{
@@ -417,6 +433,10 @@ namespace gpopt
 				 m_pmemo->ResetTreeMap();
 			}
 
+			// check if optimizing more alternatives under a context should stop
+			// since the optimization budget ran out and the context has a plan
+			BOOL FSkipAlternative(COptimizationContext *poc);
+
 			// check if parent group expression can optimize child group expression
 			BOOL FOptimizeChild(CGroupExpression *pgexprParent, CGroupExpression *pgexprChild, COptimizationContext *pocChild, EOptimizationLevel eol);
 
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CSchedulerConfig.h
+//
+//	@doc:
+//		Configuration of the optimization job scheduler
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CSchedulerConfig_H
+#define GPOPT_CSchedulerConfig_H
+
+#include "gpos/base.h"
+#include "gpos/memory/IMemoryPool.h"
+#include "gpos/common/CRefCount.h"
+
+// default number of workers used by multi-threaded optimization
+#define GPOPT_SCHED_DEFAULT_WORKERS ULONG(2)
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CSchedulerConfig
+	//
+	//	@doc:
+	//		Scheduler configurations; only relevant when optimization runs on
+	//		multiple workers (EopttraceParallel), except for the priority
+	//		policy which also orders the jobs of single-threaded optimization
+	//
+	//---------------------------------------------------------------------------
+	class CSchedulerConfig : public CRefCount
+	{
+
+		public:
+
+			// policy for distributing runnable jobs to workers
+			enum ESchedulingPolicy
+			{
+				EspSharedQueue = 0,		// all workers pick jobs from one shared list
+				EspWorkStealing,		// workers own a job deque and steal from others when idle
+				EspPriority,			// all workers pick the most promising job from one shared heap
+
+				EspSentinel
+			};
+
+			// policy for waking up idle workers
+			enum EWorkerPolicy
+			{
+				EwpQueuedRunningRatio = 0,	// wake up a worker when queued jobs outnumber active workers by a fixed ratio
+				EwpAdaptive,				// grow and shrink active workers based on the estimated cost of queued jobs
+
+				EwpSentinel
+			};
+
+		private:
+
+			// scheduling policy
+			ESchedulingPolicy m_esp;
+
+			// worker policy
+			EWorkerPolicy m_ewp;
+
+			// number of workers for multi-threaded optimization
+			ULONG m_ulWorkers;
+
+			// private copy ctor
+			CSchedulerConfig(const CSchedulerConfig &);
+
+		public:
+
+			// ctor
+			CSchedulerConfig
+				(
+				ESchedulingPolicy esp,
+				EWorkerPolicy ewp,
+				ULONG ulWorkers
+				)
+				:
+				m_esp(esp),
+				m_ewp(ewp),
+				m_ulWorkers(ulWorkers)
+			{
+				GPOS_ASSERT(EspSentinel > esp);
+				GPOS_ASSERT(EwpSentinel > ewp);
+				GPOS_ASSERT(0 < ulWorkers);
+			}
+
+			// scheduling policy
+			ESchedulingPolicy Esp() const
+			{
+				return m_esp;
+			}
+
+			// worker policy
+			EWorkerPolicy Ewp() const
+			{
+				return m_ewp;
+			}
+
+			// number of workers
+			ULONG UlWorkers() const
+			{
+				return m_ulWorkers;
+			}
+
+			// generate default scheduler configuration
+			static
+			CSchedulerConfig *PschedconfDefault(IMemoryPool *mp)
+			{
+				return GPOS_NEW(mp) CSchedulerConfig(EspSharedQueue, EwpQueuedRunningRatio, GPOPT_SCHED_DEFAULT_WORKERS);
+			}
+
+	}; // class CSchedulerConfig
+}
+
+#endif // !GPOPT_CSchedulerConfig_H
+
+// EOF
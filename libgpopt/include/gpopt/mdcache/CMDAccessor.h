@@ -358,6 +358,9 @@ namespace gpopt
 			// retrieve a scalar comparison object from the cache
 			const IMDScCmp *Pmdsccmp(IMDId *left_mdid, IMDId *right_mdid, IMDType::ECmpType cmp_type);
 
+			// construct typed buckets from an MD column stats object
+			CBucketArray *GetBucketArray(IMemoryPool *mp, IMDId *mdid_type, const IMDColStats *pmdcolstats);
+
 			// construct a statistics object for the columns of the given relation
 			IStatistics *Pstats
 				(
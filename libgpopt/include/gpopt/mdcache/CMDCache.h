@@ -18,6 +18,7 @@
 #include "gpos/memory/CCacheFactory.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/mdcache/CMDKey.h"
+#include "gpopt/mdcache/CMDSnapshot.h"
 
 namespace gpopt
 {
@@ -45,6 +46,9 @@ namespace gpopt
 			// the maximum size of the cache
 			static ULLONG m_ullCacheQuota;
 
+			// persisted snapshot consulted on cache misses
+			static CMDSnapshot *m_pmdsnap;
+
 			// private ctor
 			CMDCache()
 			{};
@@ -96,6 +100,26 @@ namespace gpopt
 				return m_pcache;
 			}
 
+			// map snapshot file and consult it on subsequent cache misses
+			static
+			void LoadSnapshot(const CHAR *szFileName);
+
+			// persist cache contents to a snapshot file, return number of
+			// objects written
+			static
+			ULONG UlSaveSnapshot(const CHAR *szFileName);
+
+			// stop consulting the loaded snapshot and unmap it
+			static
+			void DropSnapshot();
+
+			// snapshot accessor
+			static
+			CMDSnapshot *Pmdsnap()
+			{
+				return m_pmdsnap;
+			}
+
 	}; // class CMDCache
 
 }  // namespace gpopt
@@ -0,0 +1,170 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CMDSnapshot.h
+//
+//	@doc:
+//		Persistent snapshot of metadata cache contents
+//---------------------------------------------------------------------------
+
+
+#ifndef GPOPT_CMDSnapshot_H
+#define GPOPT_CMDSnapshot_H
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+
+#include "gpopt/mdcache/CMDAccessor.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+	using namespace gpmd;
+
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CMDSnapshot
+	//
+	//	@doc:
+	//		Read-only snapshot of metadata objects persisted to a binary file.
+	//
+	//		The file holds the NUL-terminated mdid and DXL strings of all
+	//		objects, followed by an index of string offsets and a trailer
+	//		carrying the index offset, entry count, format version and magic
+	//		number. The file is memory-mapped on load and objects are parsed
+	//		on first lookup only.
+	//
+	//		Objects are keyed by their full mdid, including its version; an
+	//		object that changed since the snapshot was taken is looked up by a
+	//		newer mdid, so its stale snapshot entry is never returned.
+	//
+	//---------------------------------------------------------------------------
+	class CMDSnapshot
+	{
+		private:
+
+			// index entry of a snapshot file
+			struct SEntry
+			{
+				// file offset of mdid string
+				ULLONG m_ullMDIdOffset;
+
+				// file offset of DXL string
+				ULLONG m_ullDXLOffset;
+			};
+
+			// trailer at the end of a snapshot file
+			struct STrailer
+			{
+				// magic number identifying snapshot files
+				ULLONG m_ullMagic;
+
+				// file offset of index
+				ULLONG m_ullIndexOffset;
+
+				// number of index entries
+				ULONG m_ulEntries;
+
+				// file format version
+				ULONG m_ulVersion;
+			};
+
+			// hash function of mdid strings
+			static
+			ULONG HashMDId(const CHAR *szMDId);
+
+			// equality function of mdid strings
+			static
+			BOOL FEqualMDId(const CHAR *szMDIdFst, const CHAR *szMDIdSnd);
+
+			// array of strings serialized from metadata objects
+			typedef CDynamicPtrArray<CHAR, CleanupDeleteArray> StringArray;
+
+			// context for serializing objects into a string array
+			struct SAppendContext
+			{
+				// memory pool for serialized strings
+				IMemoryPool *m_mp;
+
+				// target array of alternating mdid and DXL strings
+				StringArray *m_pdrgpsz;
+			};
+
+			// map of mdid strings to index entries; both point into the mapped file
+			typedef CHashMap<CHAR, SEntry, HashMDId, FEqualMDId,
+						CleanupNULL<CHAR>, CleanupNULL<SEntry> > MDIdToEntryMap;
+
+			// memory pool
+			IMemoryPool *m_mp;
+
+			// mapped file contents
+			const BYTE *m_pbData;
+
+			// size of mapped file
+			ULLONG m_ullSize;
+
+			// number of entries in snapshot
+			ULONG m_ulEntries;
+
+			// lookup map of snapshot entries
+			MDIdToEntryMap *m_phmmdidentry;
+
+			// number of lookups served from the snapshot
+			volatile ULONG_PTR m_ulpHits;
+
+			// private copy ctor
+			CMDSnapshot(const CMDSnapshot &);
+
+			// serialize a metadata object and append it to a string array
+			static
+			void AppendObject(IMDCacheObject *pmdobj, void *pv);
+
+			// verify and index mapped file contents
+			void LoadIndex();
+
+			// write serialized objects to a snapshot file
+			static
+			ULONG UlWrite(IMemoryPool *mp, StringArray *pdrgpsz, const CHAR *szFileName);
+
+		public:
+
+			// ctor; maps and validates the given snapshot file
+			CMDSnapshot(IMemoryPool *mp, const CHAR *szFileName);
+
+			// dtor
+			~CMDSnapshot();
+
+			// number of objects in snapshot
+			ULONG UlEntries() const
+			{
+				return m_ulEntries;
+			}
+
+			// number of lookups served from the snapshot
+			ULONG_PTR UlpHits() const
+			{
+				return m_ulpHits;
+			}
+
+			// parse object with the given mdid, return NULL if the snapshot
+			// does not have it
+			IMDCacheObject *PimdobjLookup(IMemoryPool *mp, const IMDId *mdid);
+
+			// persist an array of metadata objects, return number of objects written
+			static
+			ULONG UlSave(IMemoryPool *mp, const IMDCacheObjectArray *pdrgpmdobj, const CHAR *szFileName);
+
+			// persist contents of a metadata cache, return number of objects written
+			static
+			ULONG UlSave(IMemoryPool *mp, CMDAccessor::MDCache *pcache, const CHAR *szFileName);
+
+	}; // class CMDSnapshot
+
+}  // namespace gpopt
+
+#endif // !GPOPT_CMDSnapshot_H
+
+// EOF
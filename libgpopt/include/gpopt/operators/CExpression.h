@@ -263,6 +263,9 @@ namespace gpopt
 			// reset expression stats
 			void ResetStats();
 
+			// attach stats derived on an identical expression; expression must have no stats
+			void AttachStats(IStatistics *stats);
+
 			// compute required plan properties of all expression nodes
 			CReqdPropPlan* PrppCompute(IMemoryPool *mp, CReqdPropPlan *prppInput);
 
@@ -12,10 +12,14 @@
 #define GPOS_CLogicalNAryJoin_H
 
 #include "gpos/base.h"
+#include "gpos/sync/CMutex.h"
 #include "gpopt/operators/CLogicalJoin.h"
 
 namespace gpopt
 {	
+	// fwd declaration
+	class CJoinStatsCache;
+
 	//---------------------------------------------------------------------------
 	//	@class:
 	//		CLogicalNAryJoin
@@ -28,6 +32,12 @@ namespace gpopt
 	{
 		private:
 
+			// stats of joins built by the xforms expanding this join, created on first use
+			CJoinStatsCache *m_pjsc;
+
+			// mutex for creating the join stats cache
+			CMutex m_mutex;
+
 			// private copy ctor
 			CLogicalNAryJoin(const CLogicalNAryJoin &);
 
@@ -39,8 +49,7 @@ namespace gpopt
 
 			// dtor
 			virtual
-			~CLogicalNAryJoin() 
-			{}
+			~CLogicalNAryJoin();
 
 			// ident accessors
 			virtual 
@@ -116,6 +125,9 @@ namespace gpopt
 				return EspLow;
 			}
 
+			// stats of joins built by the join order xforms expanding this join
+			CJoinStatsCache *Pjsc();
+
 			//-------------------------------------------------------------------------------------
 			// Transformations
 			//-------------------------------------------------------------------------------------
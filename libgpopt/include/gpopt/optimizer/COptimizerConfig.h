@@ -20,6 +20,7 @@
 #include "gpopt/engine/CEnumeratorConfig.h"
 #include "gpopt/engine/CCTEConfig.h"
 #include "gpopt/engine/CHint.h"
+#include "gpopt/engine/CSchedulerConfig.h"
 #include "gpopt/base/CWindowOids.h"
 
 namespace gpopt
@@ -67,6 +68,20 @@ namespace gpopt
 			// default window oids
 			CWindowOids *m_window_oids;
 
+			// scheduler configuration
+			CSchedulerConfig *m_sched_conf;
+
+			// wall-clock budget of an optimization in milliseconds, gpos::ulong_max if unbounded
+			ULONG m_ulOptimizationBudget;
+
+			// DXL name of the given scheduling policy
+			static
+			const CWStringConst *GetSchedulingPolicyStr(CSchedulerConfig::ESchedulingPolicy esp);
+
+			// DXL name of the given worker policy
+			static
+			const CWStringConst *GetWorkerPolicyStr(CSchedulerConfig::EWorkerPolicy ewp);
+
 		public:
 
 			// ctor
@@ -77,7 +92,9 @@ namespace gpopt
 				CCTEConfig *pcteconf,
 				ICostModel *pcm,
 				CHint *phint,
-				CWindowOids *pdefoidsGPDB
+				CWindowOids *pdefoidsGPDB,
+				CSchedulerConfig *psched_conf,
+				ULONG ulOptimizationBudget = gpos::ulong_max
 				);
 
 			// dtor
@@ -121,6 +138,24 @@ namespace gpopt
 				return m_hint;
 			}
 
+			// scheduler configuration
+			CSchedulerConfig *GetSchedulerConf() const
+			{
+				return m_sched_conf;
+			}
+
+			// optimization budget in milliseconds
+			ULONG UlOptimizationBudget() const
+			{
+				return m_ulOptimizationBudget;
+			}
+
+			// is optimization time bounded
+			BOOL FBudgeted() const
+			{
+				return gpos::ulong_max != m_ulOptimizationBudget;
+			}
+
 			// generate default optimizer configurations
 			static
 			COptimizerConfig *PoconfDefault(IMemoryPool *mp);
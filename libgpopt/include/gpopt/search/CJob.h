@@ -135,6 +135,9 @@ namespace gpopt
 			// flag indicating if job is initialized
 			BOOL m_fInit;
 
+			// priority among jobs scheduled together, used by priority scheduling
+			ULONG m_ulPriority;
+
 #ifdef GPOS_DEBUG
 			// job state
 			EJobState m_ejs;
@@ -168,6 +171,12 @@ namespace gpopt
 				m_pjParent = pj;
 			}
 
+			// priority accessor
+			ULONG UlPriority() const
+			{
+				return m_ulPriority;
+			}
+
 			// increment reference counter
 			void IncRefs()
 			{
@@ -230,7 +239,8 @@ namespace gpopt
 				m_pjq(NULL),
 				m_ulpRefs(0),
 				m_id(0),
-				m_fInit(false)
+				m_fInit(false),
+				m_ulPriority(gpos::ulong_max)
 #ifdef GPOS_DEBUG
 				,
 				m_ejs(EjsInit)
@@ -265,6 +275,12 @@ namespace gpopt
 				m_fInit = true;
 			}
 
+			// set priority; jobs default to the highest priority
+			void SetPriority(ULONG ulPriority)
+			{
+				m_ulPriority = ulPriority;
+			}
+
 		public:
 
 			// actual job execution given a scheduling context
@@ -153,8 +153,8 @@ namespace gpopt
                 TEnumState estNext = estSentinel;
                 do
                 {
-                    // check if current search stage is timed-out
-                    if (psc->Peng()->PssCurrent()->FTimedOut())
+                    // check if current search stage is timed-out or the optimization budget ran out
+                    if (psc->Peng()->FStopSearch())
                     {
                         // cleanup job state and terminate state machine
                         pjOwner->Cleanup();
@@ -13,6 +13,7 @@
 
 #include "gpopt/search/CJob.h"
 #include "gpopt/search/CJobStateMachine.h"
+#include "gpopt/xforms/CXform.h"
 
 
 namespace gpopt
@@ -22,7 +23,6 @@ namespace gpopt
 	// prototypes
 	class CGroup;
 	class CGroupExpression;
-	class CXform;
 
 	//---------------------------------------------------------------------------
 	//	@class:
@@ -87,13 +87,15 @@ namespace gpopt
 			// initialize job
 			void Init(CGroupExpression *pgexpr, CXform *pxform);
 
-			// schedule a new transformation job
+			// schedule a new transformation job; the promise of the xform is
+			// the job's priority under the priority scheduling policy
 			static
 			void ScheduleJob
 				(
 				CSchedulerContext *psc,
 				CGroupExpression *pgexpr,
 				CXform *pxform,
+				CXform::EXformPromise exfp,
 				CJob *pjParent
 				);
 
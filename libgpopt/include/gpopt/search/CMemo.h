@@ -13,7 +13,8 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CRefCount.h"
-#include "gpos/common/CSyncHashtable.h"
+#include "gpos/common/CStripedHashtable.h"
+#include "gpos/common/CStripedHashtableAccessByKey.h"
 #include "gpos/common/CSyncList.h"
 #include "gpos/sync/CAtomicCounter.h"
 
@@ -47,25 +48,11 @@ namespace gpopt
 		
 			// definition of hash table key accessor
 			typedef
-					CSyncHashtableAccessByKey<
+					CStripedHashtableAccessByKey<
 						CGroupExpression, // entry
 						CGroupExpression, // search key
 						CSpinlockMemo> ShtAcc;
 
-			// definition of hash table iterator
-			typedef
-					CSyncHashtableIter<
-						CGroupExpression, // entry
-						CGroupExpression, // search key
-						CSpinlockMemo> ShtIter;
-
-			// definition of hash table iterator accessor
-			typedef
-					CSyncHashtableAccessByIter<
-						CGroupExpression, // entry
-						CGroupExpression, // search key
-						CSpinlockMemo> ShtAccIter;
-
 			// memory pool
 			IMemoryPool *m_mp;
 		
@@ -85,7 +72,7 @@ namespace gpopt
 			CSyncList<CGroup> m_listGroups;
 
 			// hashtable of all group expressions
-			CSyncHashtable<
+			CStripedHashtable<
 				CGroupExpression, // entry
 				CGroupExpression, // search key
 				CSpinlockMemo> m_sht;
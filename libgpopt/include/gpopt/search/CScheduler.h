@@ -12,15 +12,24 @@
 #define GPOPT_CScheduler_H
 
 #include "gpos/base.h"
+#include "gpos/common/CList.h"
 #include "gpos/common/CSyncList.h"
 #include "gpos/common/CSyncPool.h"
 #include "gpos/sync/CEvent.h"
 
+#include "gpopt/spinlock.h"
+#include "gpopt/engine/CSchedulerConfig.h"
 #include "gpopt/search/CJob.h"
 
 #define OPT_SCHED_QUEUED_RUNNING_RATIO 10
 #define OPT_SCHED_CFA 100
 
+// estimated cost of waking up a worker, used by adaptive worker policy
+#define OPT_SCHED_WAKEUP_COST_US 50
+
+// assumed cost of a job type that has not been executed yet
+#define OPT_SCHED_DEFAULT_JOB_COST_US 10
+
 namespace gpopt
 {
 	using namespace gpos;
@@ -52,6 +61,26 @@ namespace gpopt
 	//		complete. At this point, a queued job can be terminated if it does not
 	//		have any further dependencies.
 	//
+	//		Under the work-stealing policy, each worker owns a deque of runnable
+	//		jobs. Jobs scheduled by a worker are pushed to the head of its own
+	//		deque and popped from there (LIFO), which keeps related jobs on the
+	//		same worker. An idle worker steals from the tail of other workers'
+	//		deques before falling back to the shared list of waiting jobs.
+	//
+	//		Under the adaptive worker policy, the scheduler keeps the average
+	//		execution time of each job type, and estimates the cost of queued
+	//		jobs from it. Idle workers are woken up only if each active worker
+	//		would still get more work than the cost of a wakeup, and workers
+	//		retire early when the queued work no longer keeps them busy.
+	//
+	//		Under the priority policy, runnable jobs are kept in one shared
+	//		heap. Jobs scheduled while a job executes form a round, and later
+	//		rounds run first, which keeps the depth-first order of the shared
+	//		list. Within a round, transformation jobs run in the order of
+	//		their xform promise, so physical alternatives produced by promising
+	//		xforms are costed first and tighten the cost bounds used for
+	//		pruning the search space.
+	//
 	//---------------------------------------------------------------------------
 	class CScheduler
 	{	
@@ -81,6 +110,10 @@ namespace gpopt
 				// pointer to job
 				CJob *m_pj;
 
+				// scheduling round and sequence number, used by priority policy
+				ULLONG m_ullRound;
+				ULLONG m_ullSeq;
+
 				// slink for list of waiting jobs
 				SLink m_link;
 
@@ -92,6 +125,41 @@ namespace gpopt
 				}
 			};
 
+			// per-worker deque of runnable jobs, used by work-stealing policy
+			struct SJobDeque
+			{
+				// spinlock protecting the deque
+				CSpinlockJobDeque m_lock;
+
+				// list of runnable jobs; owner works at the head, thieves at the tail
+				CList<SJobLink> m_listjl;
+			};
+
+			// heap of runnable jobs, used by priority policy
+			struct SJobHeap
+			{
+				// spinlock protecting the heap
+				CSpinlockJobHeap m_lock;
+
+				// memory pool for growing the heap
+				IMemoryPool *m_mp;
+
+				// array of job links
+				SJobLink **m_rgpjl;
+
+				// number of job links the array can hold
+				ULONG m_ulCapacity;
+
+				// number of job links in the heap
+				ULONG m_ulSize;
+
+				// current scheduling round; a new round starts whenever a job is retrieved
+				ULLONG m_ullRound;
+
+				// sequence number of the next scheduled job
+				ULLONG m_ullSeq;
+			};
+
 			// mutex and event mechanism for individual workers
 			CMutex m_mutex;
 			CEvent m_event;
@@ -102,6 +170,18 @@ namespace gpopt
 			// pool of job link objects
 			CSyncPool<SJobLink> m_spjl;
 
+			// scheduling policy
+			const CSchedulerConfig::ESchedulingPolicy m_esp;
+
+			// array of per-worker job deques; NULL unless using work-stealing
+			SJobDeque *m_rgjd;
+
+			// heap of runnable jobs; NULL unless using priority policy
+			SJobHeap *m_pjh;
+
+			// worker policy
+			const CSchedulerConfig::EWorkerPolicy m_ewp;
+
 			// number of tasks assigned
 			const ULONG_PTR m_ulpTasksMax;
 
@@ -120,6 +200,14 @@ namespace gpopt
 			volatile ULONG_PTR m_ulpStatsCompleted;
 			volatile ULONG_PTR m_ulpStatsCompletedQueued;
 			volatile ULONG_PTR m_ulpStatsResumed;
+			volatile ULONG_PTR m_ulpStatsStolen;
+			volatile ULONG_PTR m_ulpStatsWakeups;
+			volatile ULONG_PTR m_ulpStatsRetired;
+
+			// per job type counters, maintained by adaptive worker policy
+			volatile ULONG_PTR m_rgulpQueued[CJob::EjtSentinel];
+			volatile ULONG_PTR m_rgulpStatsExecuted[CJob::EjtSentinel];
+			volatile ULONG_PTR m_rgulpStatsExecTimeUS[CJob::EjtSentinel];
 
 #ifdef GPOS_DEBUG
 			// list of running jobs
@@ -136,8 +224,9 @@ namespace gpopt
 			// internal job processing task
 			void ProcessJobs(CSchedulerContext *psc);
 
-			// keep executing waiting jobs (if any)
-			void ExecuteJobs(CSchedulerContext *psc);
+			// keep executing waiting jobs (if any); returns true if worker
+			// retired before running out of jobs
+			BOOL FExecuteJobs(CSchedulerContext *psc);
 
 			// process job execution results
 			void ProcessJobResult
@@ -147,11 +236,30 @@ namespace gpopt
 				BOOL fCompleted
 				);
 
+			// deque owned by the worker of the given context; NULL if there is none
+			SJobDeque *PjdLocal(CSchedulerContext *psc) const;
+
+			// pop a job link from the head of the given deque
+			SJobLink *PjlPop(SJobDeque *pjd);
+
+			// steal a job link from the tail of another worker's deque
+			SJobLink *PjlSteal(CSchedulerContext *psc);
+
+			// check if first job link runs before the second one under priority policy
+			static
+			BOOL FPrecedes(const SJobLink *pjlFst, const SJobLink *pjlSnd);
+
+			// add a job link to the heap
+			void PushHeap(SJobLink *pjl);
+
+			// remove the job link with the highest priority from the heap
+			SJobLink *PjlPopHeap();
+
 			// retrieve next job to run
-			CJob *PjRetrieve();
+			CJob *PjRetrieve(CSchedulerContext *psc);
 
 			// schedule job for execution
-			void Schedule(CJob *pj);
+			void Schedule(CJob *pj, CSchedulerContext *psc);
 
 			// prepare for job execution
 			void PreExecute(CJob *pj);
@@ -163,7 +271,7 @@ namespace gpopt
 			EJobResult EjrPostExecute(CJob *pj, BOOL fCompleted);
 
 			// resume parent job
-			void ResumeParent(CJob *pj);
+			void ResumeParent(CJob *pj, CSchedulerContext *psc);
 
 			// check if all jobs have completed
 			BOOL IsEmpty() const
@@ -183,18 +291,31 @@ namespace gpopt
 				(void) ExchangeAddUlongPtrWithInt(&m_ulpTasksActive, -1);
 			}
 
-			// check if there is enough work for more workers
-			BOOL FIncreaseWorkers() const
+			// check if adaptive worker policy is used
+			BOOL FAdaptive() const
 			{
-				GPOS_ASSERT(m_ulpTasksMax >= m_ulpRunning);
-				return
-					(
-					m_ulpTasksMax > m_ulpTasksActive &&
-					(OPT_SCHED_QUEUED_RUNNING_RATIO < m_ulpQueued / (m_ulpTasksActive + 1))
-				    )
-				    ;
+				return CSchedulerConfig::EwpAdaptive == m_ewp;
 			}
 
+			// average execution time of given job type
+			ULLONG UllAvgExecTimeUS(CJob::EJobType ejt) const;
+
+			// estimated execution time of queued jobs
+			ULLONG UllQueuedCostUS() const;
+
+			// record execution time of a job
+			void RecordExecution(CJob::EJobType ejt, ULONG ulTimeUS);
+
+			// check if there is enough work for more workers
+			BOOL FIncreaseWorkers() const;
+
+			// check if there is too little work for the active workers
+			BOOL FDecreaseWorkers() const;
+
+			// leave the set of active workers if there is too little work;
+			// the last active worker never retires
+			BOOL FRetireWorker();
+
 			// no copy ctor
 			CScheduler(const CScheduler&);
 
@@ -205,7 +326,9 @@ namespace gpopt
 				(
 				IMemoryPool *mp,
 				ULONG ulJobs,
-				ULONG_PTR ulpTasks
+				ULONG_PTR ulpTasks,
+				CSchedulerConfig::ESchedulingPolicy esp,
+				CSchedulerConfig::EWorkerPolicy ewp
 #ifdef GPOS_DEBUG
 				,
 				BOOL fTrackingJobs = true
@@ -220,19 +343,32 @@ namespace gpopt
 			void *Run(void*);
 
 			// transition job to completed
-			void Complete(CJob *pj);
+			void Complete(CJob *pj, CSchedulerContext *psc);
 
 			// transition queued job to completed
-			void CompleteQueued(CJob *pj);
+			void CompleteQueued(CJob *pj, CSchedulerContext *psc);
 
 			// transition job to suspended
 			void Suspend(CJob *pj);
 			
-			// add new job for scheduling
-			void Add(CJob *pj, CJob *pjParent);
+			// add new job for scheduling; psc is the context of the calling
+			// worker, or NULL if the caller is not a scheduler worker
+			void Add(CJob *pj, CJob *pjParent, CSchedulerContext *psc);
 
 			// resume suspended job
-			void Resume(CJob *pj);
+			void Resume(CJob *pj, CSchedulerContext *psc);
+
+			// scheduling policy
+			CSchedulerConfig::ESchedulingPolicy Esp() const
+			{
+				return m_esp;
+			}
+
+			// worker policy
+			CSchedulerConfig::EWorkerPolicy Ewp() const
+			{
+				return m_ewp;
+			}
 
 			// print statistics
 			void PrintStats() const;
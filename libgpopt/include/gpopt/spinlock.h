@@ -19,6 +19,12 @@ namespace gpopt
 
 	// OPTIMIZER SPINLOCKS - reserve range 200-400
 
+	// spinlock used in per-worker job deques of scheduler
+	typedef CSpinlockRanked<200> CSpinlockJobDeque;
+
+	// spinlock used in priority heap of runnable jobs of scheduler
+	typedef CSpinlockRanked<201> CSpinlockJobHeap;
+
 	// spinlock used in job queues
 	typedef CSpinlockRanked<210> CSpinlockJobQueue;
 
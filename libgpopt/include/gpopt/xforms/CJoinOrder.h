@@ -12,6 +12,7 @@
 #define GPOPT_CJoinOrder_H
 
 #include "gpos/base.h"
+#include "gpos/common/CBitSet.h"
 #include "gpopt/operators/CExpression.h"
 #include "gpos/io/IOstream.h"
 
@@ -19,9 +20,15 @@
 // the child of LOJ
 #define NON_LOJ_DEFAULT_ID 0
 
+// maximum number of components whose covers are also kept as bit masks
+#define GPOPT_JOIN_ORDER_MASK_COMPONENTS 64
+
 namespace gpopt
 {
 	using namespace gpos;
+
+	// fwd declaration
+	class CJoinStatsCache;
 	
 	//---------------------------------------------------------------------------
 	//	@class:
@@ -55,6 +62,9 @@ namespace gpopt
 			{
 				// cover of edge
 				CBitSet *m_pbs;
+
+				// cover of edge as a bit mask, if components fit into one
+				ULLONG m_ullCover;
 				
 				// associated conjunct
 				CExpression *m_pexpr;
@@ -89,6 +99,9 @@ namespace gpopt
 				// cover
 				CBitSet *m_pbs;
 
+				// cover as a bit mask, if components fit into one
+				ULLONG m_ullCover;
+
 				// set of edges associated with this component (stored as indexes into m_rgpedge array)
 				CBitSet *m_edge_set;
 
@@ -195,6 +208,47 @@ namespace gpopt
 			// join order
 			BOOL m_include_loj_childs;
 
+			// are covers of components and edges also kept as bit masks
+			BOOL m_fCoverMasks;
+
+			// stats of joins shared with other join orders of the same n-ary join, if any
+			CJoinStatsCache *m_pjsc;
+
+			// does the given cover contain the cover of the given edge
+			BOOL FCovers(CBitSet *pbs, ULLONG ullCover, SEdge *pedge) const
+			{
+				if (m_fCoverMasks)
+				{
+					return 0 == (pedge->m_ullCover & ~ullCover);
+				}
+
+				return pbs->ContainsAll(pedge->m_pbs);
+			}
+
+			// bit mask of a single component
+			static
+			ULLONG UllComponent
+				(
+				ULONG ulComp
+				)
+			{
+				GPOS_ASSERT(ulComp < GPOPT_JOIN_ORDER_MASK_COMPONENTS);
+
+				return ((ULLONG) 1) << ulComp;
+			}
+
+			// bit mask of the components in the given set
+			static
+			ULLONG UllMask(const CBitSet *pbs);
+
+			// number of components in the given bit mask
+			static
+			ULONG UlComponents(ULLONG ull);
+
+			// first component in the given non-empty bit mask
+			static
+			ULONG UlFirstComponent(ULLONG ull);
+
 			// compute cover of each edge
 			void ComputeEdgeCover();
 
@@ -205,6 +259,10 @@ namespace gpopt
 			virtual
 			void DeriveStats(CExpression *pexpr);
 
+			// derive stats on a join of the components in the given cover,
+			// reusing the stats of an identical join from the stats cache
+			void DeriveCoverStats(CExpression *pexpr, ULLONG ullCover);
+
 			// mark edges used by expression
 			void MarkUsedEdges(SComponent *comp);
 
@@ -242,6 +300,9 @@ namespace gpopt
 			virtual
 			IOstream &OsPrint(IOstream &) const;
 
+			// share stats of joins with other join orders of the same n-ary join
+			void SetStatsCache(CJoinStatsCache *pjsc);
+
 			// is this a valid join combination
 			BOOL IsValidJoinCombination(SComponent *comp1, SComponent *comp2) const;
 
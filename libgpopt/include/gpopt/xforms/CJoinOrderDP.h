@@ -13,10 +13,12 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CHashMap.h"
-#include "gpos/common/CBitSet.h"
 #include "gpos/io/IOstream.h"
+#include "gpos/sync/CAtomicCounter.h"
+#include "gpopt/base/CReqdPropRelational.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/xforms/CJoinOrder.h"
+#include "gpopt/xforms/CJoinOrderTable.h"
 #include "gpopt/operators/CExpression.h"
 
 
@@ -29,7 +31,9 @@ namespace gpopt
 	//		CJoinOrderDP
 	//
 	//	@doc:
-	//		Helper class for creating join orders using dynamic programming
+	//		Helper class for creating join orders using dynamic programming;
+	//		sets of components are kept as bit masks, so at most
+	//		GPOPT_JOIN_ORDER_MASK_COMPONENTS components can be joined
 	//
 	//---------------------------------------------------------------------------
 	class CJoinOrderDP : public CJoinOrder
@@ -39,78 +43,63 @@ namespace gpopt
 
 			//---------------------------------------------------------------------------
 			//	@struct:
-			//		SComponentPair
+			//		SCsgCmp
 			//
 			//	@doc:
-			//		Struct to capture a pair of components
+			//		Pair of a connected subset and a connected complement
 			//
 			//---------------------------------------------------------------------------
-			struct SComponentPair : public CRefCount
+			struct SCsgCmp
 			{
-				// first component
-				CBitSet *m_pbsFst;
+				// connected subset
+				ULLONG m_ullCsg;
 
-				// second component
-				CBitSet *m_pbsSnd;
-
-				// ctor
-				SComponentPair(CBitSet *pbsFst, CBitSet *pbsSnd);
-
-				// dtor
-				~SComponentPair();
-
-				// hashing function
-				static
-				ULONG HashValue(const SComponentPair *pcomppair);
-
-				// equality function
-				static
-				BOOL Equals(const SComponentPair *pcomppairFst, const SComponentPair *pcomppairSnd);
+				// connected complement
+				ULLONG m_ullCmp;
 			};
 
-			// hashing function
-			static
-			ULONG UlHashBitSet
-				(
-				const CBitSet *pbs
-				)
-			{
-				GPOS_ASSERT(NULL != pbs);
-
-				return pbs->HashValue();
-			}
-
-			 // equality function
-			static
-			BOOL FEqualBitSet
-				(
-				const CBitSet *pbsFst,
-				const CBitSet *pbsSnd
-				)
+			//---------------------------------------------------------------------------
+			//	@struct:
+			//		SStatsDerivation
+			//
+			//	@doc:
+			//		Expressions whose stats are derived by concurrent tasks, each
+			//		task taking the next expression until none is left
+			//
+			//---------------------------------------------------------------------------
+			struct SStatsDerivation
 			{
-				GPOS_ASSERT(NULL != pbsFst);
-				GPOS_ASSERT(NULL != pbsSnd);
+				// expressions to derive stats on
+				CExpressionArray *m_pdrgpexpr;
 
-				return pbsFst->Equals(pbsSnd);
-			}
+				// columns to derive stats for
+				CReqdPropRelational *m_prprel;
 
-			// hash map from component to best join order
-			typedef CHashMap<CBitSet, CExpression, UlHashBitSet, FEqualBitSet,
-				CleanupRelease<CBitSet>, CleanupRelease<CExpression> > BitSetToExpressionMap;
+				// index of next expression
+				CAtomicULONG m_aulNext;
 
-			// hash map from component pair to connecting edges
-			typedef CHashMap<SComponentPair, CExpression, SComponentPair::HashValue, SComponentPair::Equals,
-				CleanupRelease<SComponentPair>, CleanupRelease<CExpression> > ComponentPairToExpressionMap;
+				// ctor
+				SStatsDerivation
+					(
+					CExpressionArray *pdrgpexpr,
+					CReqdPropRelational *prprel
+					)
+					:
+					m_pdrgpexpr(pdrgpexpr),
+					m_prprel(prprel),
+					m_aulNext(0)
+				{}
+			};
 
 			// hash map from expression to cost of best join order
 			typedef CHashMap<CExpression, CDouble, CExpression::HashValue, CUtils::Equals,
 				CleanupRelease<CExpression>, CleanupDelete<CDouble> > ExpressionToCostMap;
 
-			// lookup table for links
-			ComponentPairToExpressionMap *m_phmcomplink;
+			// lookup table for links, from a pair of component sets to their connecting edges
+			CJoinOrderTable *m_pjotLinks;
 
-			// dynamic programming table
-			BitSetToExpressionMap *m_phmbsexpr;
+			// dynamic programming table, from a component set to its best join order
+			CJoinOrderTable *m_pjotBest;
 
 			// map of expressions to its cost
 			ExpressionToCostMap *m_phmexprcost;
@@ -121,35 +110,104 @@ namespace gpopt
 			// dummy expression to used for non-joinable components
 			CExpression *m_pexprDummy;
 
+			// components sharing an edge with each component
+			ULLONG *m_rgullNeighbors;
+
+			// set whose connected subsets have all been solved, if any
+			ULLONG m_ullEnumerated;
+
+			// number of connected subset / connected complement pairs enumerated
+			ULONG m_ulCsgCmpPairs;
+
+			// pairs of the set being enumerated, in enumeration order
+			SCsgCmp *m_rgcsgcmp;
+
+			// number of pairs of the set being enumerated
+			ULONG m_ulPairs;
+
+			// number of pairs allocated
+			ULONG m_ulPairSlots;
+
+			// columns of the join predicates, derived on all stats of join orders
+			// found over connected subsets
+			CReqdPropRelational *m_prprelJoin;
+
+			// number of tasks deriving the stats of join orders found over
+			// connected subsets
+			ULONG m_ulWorkers;
+
 			// build expression linking given components
-			CExpression *PexprBuildPred(CBitSet *pbsFst, CBitSet *pbsSnd);
+			CExpression *PexprBuildPred(ULLONG ullFst, ULLONG ullSnd);
 
 			// lookup best join order for given set
-			CExpression *PexprLookup(CBitSet *pbs);
+			CExpression *PexprLookup(ULLONG ull);
+
+			// store join order of given set in DP table
+			void InsertBest(ULLONG ull, CExpression *pexpr);
 
 			// extract predicate joining the two given sets
-			CExpression *PexprPred(CBitSet *pbsFst, CBitSet *pbsSnd);
+			CExpression *PexprPred(ULLONG ullFst, ULLONG ullSnd);
 
 			// join expressions in the given two sets
-			CExpression *PexprJoin(CBitSet *pbsFst, CBitSet *pbsSnd);
+			CExpression *PexprJoin(ULLONG ullFst, ULLONG ullSnd);
 
 			// join expressions in the given set
-			CExpression *PexprJoin(CBitSet *pbs);
+			CExpression *PexprJoin(ULLONG ull);
 
 			// find best join order for given component using dynamic programming
-			CExpression *PexprBestJoinOrderDP(CBitSet *pbs);
+			CExpression *PexprBestJoinOrderDP(ULLONG ull);
+
+			// find best join order for given component by trying all its splits
+			CExpression *PexprBestJoinOrderSplits(ULLONG ull);
+
+			// components of the given set adjacent to a subset of it, and not excluded
+			ULLONG UllNeighborhood(ULLONG ull, ULLONG ullSubset, ULLONG ullExcluded) const;
+
+			// enumerate connected subsets of the given set and their connected complements
+			void EnumerateCsgCmpPairs(ULLONG ull);
+
+			// enumerate connected subsets extending the given one
+			void EnumerateCsgRec(ULLONG ull, ULLONG ullCsg, ULLONG ullExcluded);
+
+			// enumerate connected complements of the given connected subset
+			void EmitCsg(ULLONG ull, ULLONG ullCsg);
+
+			// enumerate connected complements extending the given one
+			void EnumerateCmpRec(ULLONG ull, ULLONG ullCsg, ULLONG ullCmp, ULLONG ullExcluded);
+
+			// record a pair of a connected subset and a connected complement
+			void EmitCsgCmp(ULLONG ullCsg, ULLONG ullCmp);
+
+			// solve the pairs of the given set in order of the size of their union
+			void SolveCsgCmpPairs(ULLONG ull);
+
+			// join a connected subset with a connected complement
+			void JoinCsgCmp(ULLONG ullCsg, ULLONG ullCmp, ULLONG *rgullSolved, ULONG *pulSolved);
+
+			// are the two given sets connected by a fully covered edge
+			BOOL FConnected(ULLONG ullFst, ULLONG ullSnd) const;
+
+			// cost of the best join order of the given set
+			CDouble DCostBest(ULLONG ull, CExpression *pexprBest);
+
+			// derive stats on join orders of connected subsets
+			void DeriveJoinOrderStats(CExpressionArray *pdrgpexpr);
+
+			// derive stats on the expressions not yet taken by other tasks
+			static
+			void *PvDeriveStats(void *pv);
 
 			// find best join order for given component
-			CExpression *PexprBestJoinOrder(CBitSet *pbs);
+			CExpression *PexprBestJoinOrder(ULLONG ull);
 
 			// generate cross product for the given components
-			CExpression *PexprCross(CBitSet *pbs);
+			CExpression *PexprCross(ULLONG ull);
 
 			// join a covered subset with uncovered subset
-			CExpression *PexprJoinCoveredSubsetWithUncoveredSubset(CBitSet *pbs, CBitSet *pbsCovered, CBitSet *pbsUncovered);
+			CExpression *PexprJoinCoveredSubsetWithUncoveredSubset(ULLONG ull, ULLONG ullCovered, ULLONG ullUncovered);
 
 			// return a subset of the given set covered by one or more edges
-			CBitSet *PbsCovered(CBitSet *pbsInput);
+			ULLONG UllCovered(ULLONG ullInput) const;
 
 			// add given join order to best results
 			void AddJoinOrder(CExpression *pexprJoin, CDouble dCost);
@@ -164,14 +222,6 @@ namespace gpopt
 			// add expression to cost map
 			void InsertExpressionCost(CExpression *pexpr, CDouble dCost, BOOL fValidateInsert);
 
-			// generate all subsets of the given array of elements
-			static
-			void GenerateSubsets(IMemoryPool *mp, CBitSet *pbsCurrent, ULONG *pulElems, ULONG size, ULONG ulIndex, CBitSetArray *pdrgpbsSubsets);
-
-			// driver of subset generation
-			static
-			CBitSetArray *PdrgpbsSubsets(IMemoryPool *mp, CBitSet *pbs);
-
 		public:
 
 			// ctor
@@ -196,6 +246,12 @@ namespace gpopt
 				return m_pdrgpexprTopKOrders;
 			}
 
+			// number of connected subset / connected complement pairs enumerated
+			ULONG UlCsgCmpPairs() const
+			{
+				return m_ulCsgCmpPairs;
+			}
+
 			// print function
 			virtual
 			IOstream &OsPrint(IOstream &) const;
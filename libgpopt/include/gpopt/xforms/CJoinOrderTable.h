@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CJoinOrderTable.h
+//
+//	@doc:
+//		Open-addressed table of join expressions keyed by component masks
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CJoinOrderTable_H
+#define GPOPT_CJoinOrderTable_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+
+#include "gpopt/operators/CExpression.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CJoinOrderTable
+	//
+	//	@doc:
+	//		Table of join expressions and their costs, keyed by a pair of bit
+	//		masks of join order components; tables keyed by a single set of
+	//		components leave the second mask empty.
+	//
+	//		Entries are stored inline in a single array allocated from the
+	//		memory pool and probed linearly, so lookups neither allocate nor
+	//		follow pointers; the array doubles once it is half full.
+	//
+	//---------------------------------------------------------------------------
+	class CJoinOrderTable
+	{
+		public:
+
+			//---------------------------------------------------------------------------
+			//	@struct:
+			//		SEntry
+			//
+			//	@doc:
+			//		Entry of the table
+			//
+			//---------------------------------------------------------------------------
+			struct SEntry
+			{
+				// first key; empty entries have no components in it
+				ULLONG m_ullFst;
+
+				// second key
+				ULLONG m_ullSnd;
+
+				// expression, owned by the table; NULL until set by the caller
+				CExpression *m_pexpr;
+
+				// cost of expression
+				DOUBLE m_dCost;
+
+				// is the cost of the expression known
+				BOOL m_fCosted;
+			};
+
+		private:
+
+			// memory pool
+			IMemoryPool *m_mp;
+
+			// entries
+			SEntry *m_rgentry;
+
+			// number of entries allocated, a power of two
+			ULONG m_ulSlots;
+
+			// number of used entries
+			ULONG m_ulEntries;
+
+			// private copy ctor
+			CJoinOrderTable(const CJoinOrderTable &);
+
+			// index of the entry with the given keys, or of the empty entry to insert them at
+			ULONG UlProbe(ULLONG ullFst, ULLONG ullSnd) const;
+
+			// double the number of entries
+			void Grow();
+
+		public:
+
+			// ctor
+			CJoinOrderTable(IMemoryPool *mp, ULONG ulSlots);
+
+			// dtor
+			~CJoinOrderTable();
+
+			// number of used entries
+			ULONG Size() const
+			{
+				return m_ulEntries;
+			}
+
+			// lookup entry with the given keys; return NULL if not found
+			SEntry *PentryFind(ULLONG ullFst, ULLONG ullSnd = 0) const;
+
+			// lookup entry with the given keys, adding an entry without an
+			// expression if not found; entries move when the table grows, so
+			// they are only valid until the next insertion
+			SEntry *PentryInsert(ULLONG ullFst, ULLONG ullSnd = 0);
+
+			// set the expression of an entry, releasing its previous one; the
+			// table takes over the reference to the given expression
+			static
+			void SetExpression(SEntry *pentry, CExpression *pexpr);
+
+			// set the expression of an entry and its cost
+			static
+			void SetExpression(SEntry *pentry, CExpression *pexpr, CDouble dCost);
+
+	}; // class CJoinOrderTable
+
+}
+
+#endif // !GPOPT_CJoinOrderTable_H
+
+// EOF
@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CJoinStatsCache.h
+//
+//	@doc:
+//		Cache of join statistics shared by the join orders of an n-ary join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CJoinStatsCache_H
+#define GPOPT_CJoinStatsCache_H
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/common/CRefCount.h"
+#include "gpos/sync/CMutex.h"
+
+#include "gpopt/operators/CExpression.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CJoinStatsCache
+	//
+	//	@doc:
+	//		Statistics of join expressions built by join order generators,
+	//		keyed by the bit mask of the join order components they cover.
+	//
+	//		Cardinality estimates depend on the shape of the join tree, so a
+	//		cached entry is only reused for a join tree identical to the one
+	//		its statistics were derived on; the mask narrows the trees that
+	//		need to be compared. Lookups and insertions are synchronized since
+	//		the xforms expanding an n-ary join may run concurrently.
+	//
+	//---------------------------------------------------------------------------
+	class CJoinStatsCache : public CRefCount
+	{
+		private:
+
+			//---------------------------------------------------------------------------
+			//	@struct:
+			//		SEntry
+			//
+			//	@doc:
+			//		Cached join and its statistics; entries of the same mask are
+			//		chained
+			//
+			//---------------------------------------------------------------------------
+			struct SEntry : public CRefCount
+			{
+				// join expression
+				CExpression *m_pexpr;
+
+				// statistics derived on join expression
+				IStatistics *m_pstats;
+
+				// next entry of the same mask
+				SEntry *m_pentryNext;
+
+				// ctor
+				SEntry(CExpression *pexpr, IStatistics *stats);
+
+				// dtor
+				virtual
+				~SEntry();
+			};
+
+			// map of component masks to chains of entries
+			typedef CHashMap<ULLONG, SEntry, gpos::HashValue<ULLONG>, gpos::Equals<ULLONG>,
+						CleanupDelete<ULLONG>, CleanupRelease<SEntry> > UllToEntryMap;
+
+			// memory pool
+			IMemoryPool *m_mp;
+
+			// cached entries
+			UllToEntryMap *m_phmullentry;
+
+			// mutex for accessing entries and counters
+			CMutex m_mutex;
+
+			// number of lookups
+			ULONG m_ulLookups;
+
+			// number of lookups finding an identical join
+			ULONG m_ulHits;
+
+			// private copy ctor
+			CJoinStatsCache(const CJoinStatsCache &);
+
+			// are the two join trees identical, including the groups their leaves are bound to
+			static
+			BOOL FIdentical(const CExpression *pexprFst, const CExpression *pexprSnd);
+
+		public:
+
+			// ctor
+			explicit
+			CJoinStatsCache(IMemoryPool *mp);
+
+			// dtor
+			virtual
+			~CJoinStatsCache();
+
+			// lookup statistics of a join identical to the given one covering the
+			// given components; return an add-ref'd object or NULL if not found
+			IStatistics *PstatsLookup(ULLONG ullCover, const CExpression *pexpr);
+
+			// cache the statistics derived on the given join covering the given components
+			void Insert(ULLONG ullCover, CExpression *pexpr);
+
+			// number of lookups
+			ULONG UlLookups() const
+			{
+				return m_ulLookups;
+			}
+
+			// number of lookups finding an identical join
+			ULONG UlHits() const
+			{
+				return m_ulHits;
+			}
+
+	}; // class CJoinStatsCache
+
+}
+
+#endif // !GPOPT_CJoinStatsCache_H
+
+// EOF
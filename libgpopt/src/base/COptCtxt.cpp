@@ -131,6 +131,42 @@ COptCtxt::PoctxtCreate
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptCtxt::FBudgeted
+//
+//	@doc:
+//		Is optimization bounded by the configured budget; the budget is
+//		ignored when plans are enumerated or sampled, since both need the
+//		complete search space
+//
+//---------------------------------------------------------------------------
+BOOL
+COptCtxt::FBudgeted() const
+{
+	CEnumeratorConfig *pec = m_optimizer_config->GetEnumeratorCfg();
+
+	return m_optimizer_config->FBudgeted() && !pec->FEnumerate() && !pec->FSample();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptCtxt::FBudgetExceeded
+//
+//	@doc:
+//		Has optimization exceeded the configured budget; the budget covers
+//		the whole optimization, including query preprocessing
+//
+//---------------------------------------------------------------------------
+BOOL
+COptCtxt::FBudgetExceeded() const
+{
+	return FBudgeted() &&
+			m_clockOptimization.ElapsedMS() > m_optimizer_config->UlOptimizationBudget();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptCtxt::FAllEnforcersEnabled
@@ -85,7 +85,9 @@ CEngine::CEngine
 	m_pdrgpulpXformCalls(NULL),
 	m_pdrgpulpXformTimes(NULL),
 	m_pdrgpulpXformBindings(NULL),
-	m_pdrgpulpXformResults(NULL)
+	m_pdrgpulpXformResults(NULL),
+	m_fBudgeted(false),
+	m_fBudgetExhausted(false)
 {
 	m_pmemo = GPOS_NEW(mp) CMemo(mp);
 	m_pexprEnforcerPattern = GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp));
@@ -1563,6 +1565,81 @@ CEngine::FinalizeSearchStage()
 
 	m_ulCurrSearchStage++;
 	m_pmemo->ResetGroupStates();
+
+	// the stage has extracted a plan, so there is no point in starting
+	// another one once the budget has run out
+	if (m_fBudgeted && COptCtxt::PoctxtFromTLS()->FBudgetExceeded())
+	{
+		m_fBudgetExhausted = true;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FPlanFound
+//
+//	@doc:
+//		Check if a complete plan has been found for the root group in any
+//		search stage
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FPlanFound()
+{
+	COptimizationContext *poc = PgroupRoot()->PocLookupBest(m_mp, m_search_stage_array->Size(), m_pqc->Prpp());
+
+	return NULL != poc && NULL != poc->PccBest();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FSkipAlternative
+//
+//	@doc:
+//		Check if optimizing more group expressions under the given context
+//		should stop; once the optimization budget runs out, the first plan
+//		found for a context is kept, so the search reaches a complete plan
+//		for the root group as soon as possible
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FSkipAlternative
+	(
+	COptimizationContext *poc
+	)
+{
+	return m_fBudgeted && NULL != poc->PccBest() && COptCtxt::PoctxtFromTLS()->FBudgetExceeded();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FStopSearch
+//
+//	@doc:
+//		Check if optimization jobs should stop; once the optimization budget
+//		runs out, jobs keep running until the root group has a complete
+//		plan, which is then extracted as the cheapest plan found so far
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FStopSearch()
+{
+	if (PssCurrent()->FTimedOut())
+	{
+		return true;
+	}
+
+	if (m_fBudgeted && !m_fBudgetExhausted &&
+		COptCtxt::PoctxtFromTLS()->FBudgetExceeded() && FPlanFound())
+	{
+		// the flag only ever changes to true, so concurrent workers may set it unsynchronized
+		m_fBudgetExhausted = true;
+	}
+
+	return m_fBudgetExhausted;
 }
 
 
@@ -1700,16 +1777,17 @@ void
 CEngine::Optimize()
 {
 	COptimizerConfig *optimizer_config = COptCtxt::PoctxtFromTLS()->GetOptimizerConfig();
+	m_fBudgeted = COptCtxt::PoctxtFromTLS()->FBudgeted();
 
 	CAutoTimer at("\n[OPT]: Total Optimization Time", GPOS_FTRACE(EopttracePrintOptimizationStatistics));
 
 	if (GPOS_FTRACE(EopttraceParallel))
 	{
-		MultiThreadedOptimize(2 /*ulWorkers*/);
+		MultiThreadedOptimize(optimizer_config->GetSchedulerConf());
 	}
 	else
 	{
-		MainThreadOptimize();
+		MainThreadOptimize(optimizer_config->GetSchedulerConf());
 	}
 
 	{
@@ -1717,6 +1795,10 @@ CEngine::Optimize()
 		{
 			CAutoTrace atSearch(m_mp);
 			atSearch.Os() << "[OPT]: Search terminated at stage " << m_ulCurrSearchStage << "/" << m_search_stage_array->Size();
+			if (m_fBudgetExhausted)
+			{
+				atSearch.Os() << ", optimization budget of " << optimizer_config->UlOptimizationBudget() << "ms exceeded";
+			}
 		}
 	}
 
@@ -1732,18 +1814,30 @@ CEngine::Optimize()
 //		CEngine::MainThreadOptimize
 //
 //	@doc:
-//		Run optimizer on the main thread
+//		Run optimizer on the main thread; of the scheduling policies only
+//		the priority policy matters for a single worker, since it changes
+//		the order in which jobs run
 //
 //---------------------------------------------------------------------------
 void
-CEngine::MainThreadOptimize()
+CEngine::MainThreadOptimize
+	(
+	const CSchedulerConfig *psched_conf
+	)
 {
 	GPOS_ASSERT(NULL != PgroupRoot());
 	GPOS_ASSERT(NULL != COptCtxt::PoctxtFromTLS());
+	GPOS_ASSERT(NULL != psched_conf);
+
+	CSchedulerConfig::ESchedulingPolicy esp = CSchedulerConfig::EspSharedQueue;
+	if (CSchedulerConfig::EspPriority == psched_conf->Esp())
+	{
+		esp = CSchedulerConfig::EspPriority;
+	}
 
 	const ULONG ulJobs = std::min((ULONG) GPOPT_JOBS_CAP, (ULONG) (m_pmemo->UlpGroups() * GPOPT_JOBS_PER_GROUP));
 	CJobFactory jf(m_mp, ulJobs);
-	CScheduler sched(m_mp, ulJobs, 1 /*ulWorkers*/);
+	CScheduler sched(m_mp, ulJobs, 1 /*ulWorkers*/, esp, CSchedulerConfig::EwpQueuedRunningRatio);
 
 	CSchedulerContext sc;
 	sc.Init(m_mp, &jf, &sched, this);
@@ -1786,6 +1880,11 @@ CEngine::MainThreadOptimize()
 
 		FinalizeSearchStage();
 	}
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		sched.PrintStats();
+	}
 }
 
 
@@ -1800,15 +1899,17 @@ CEngine::MainThreadOptimize()
 void
 CEngine::MultiThreadedOptimize
 	(
-	ULONG  ulWorkers
+	const CSchedulerConfig *psched_conf
 	)
 {
 	GPOS_ASSERT(NULL != PgroupRoot());
 	GPOS_ASSERT(NULL != COptCtxt::PoctxtFromTLS());
+	GPOS_ASSERT(NULL != psched_conf);
 
+	const ULONG ulWorkers = psched_conf->UlWorkers();
 	const ULONG ulJobs = std::min((ULONG) GPOPT_JOBS_CAP, (ULONG) (m_pmemo->UlpGroups() * GPOPT_JOBS_PER_GROUP));
 	CJobFactory jf(m_mp, ulJobs);
-	CScheduler sched(m_mp, ulJobs, ulWorkers);
+	CScheduler sched(m_mp, ulJobs, ulWorkers, psched_conf->Esp(), psched_conf->Ewp());
 
 	CSchedulerContext sc;
 	sc.Init(m_mp, &jf, &sched, this);
@@ -1849,7 +1950,7 @@ CEngine::MultiThreadedOptimize
 			for (ULONG i = 0; i < ulWorkers; i++)
 			{
 				// initialize scheduling context
-				a_rgsc[i].Init(m_mp, &jf, &sched, this);
+				a_rgsc[i].Init(m_mp, &jf, &sched, this, i /*ulWorkerId*/);
 
 				// create scheduling task
 				a_rgptsk[i] = atp.Create(CScheduler::Run, &a_rgsc[i]);
@@ -1888,6 +1989,11 @@ CEngine::MultiThreadedOptimize
 
 		FinalizeSearchStage();
 	}
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		sched.PrintStats();
+	}
 }
 
 //---------------------------------------------------------------------------
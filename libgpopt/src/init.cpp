@@ -67,6 +67,7 @@ void gpopt_init()
 void gpopt_terminate()
 {
 #ifdef GPOS_DEBUG
+	CMDCache::DropSnapshot();
 	CMDCache::Shutdown();
 
 	CMemoryPoolManager::GetMemoryPoolMgr()->Destroy(mp);
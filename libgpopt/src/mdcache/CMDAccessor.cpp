@@ -22,6 +22,8 @@
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/mdcache/CMDAccessorUtils.h"
+#include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/mdcache/CMDSnapshot.h"
 
 
 #include "naucrates/exception.h"
@@ -591,25 +593,37 @@ CMDAccessor::GetImdObj
 		IMDCacheObject *pmdobjNew = a_pmdcacc->Val();
 		if (NULL == pmdobjNew)
 		{
-			// object not found in MD cache: retrieve it from MD provider
+			// object not found in MD cache: retrieve it from the persisted
+			// snapshot if there is one, or from MD provider otherwise
 			CTimerUser timerFetch;
 			if (fPrintOptStats)
 			{
 				timerFetch.Restart();
 			}
-			CAutoP<CWStringBase> a_pstr;
-			a_pstr = pmdp->GetMDObjDXLStr(m_mp, this, mdid);
-			
-			GPOS_ASSERT(NULL != a_pstr.Value());
 			IMemoryPool *mp = m_mp;
-			
+			CMDSnapshot *pmdsnap = NULL;
+
 			if (IMDId::EmdidGPDBCtas != mdid->MdidType())
 			{
 				// create the accessor memory pool
 				mp = a_pmdcacc->Pmp();
+				pmdsnap = CMDCache::Pmdsnap();
+			}
+
+			if (NULL != pmdsnap)
+			{
+				pmdobjNew = pmdsnap->PimdobjLookup(mp, mdid);
 			}
 
-			pmdobjNew = gpdxl::CDXLUtils::ParseDXLToIMDIdCacheObj(mp, a_pstr.Value(), NULL /* XSD path */);
+			if (NULL == pmdobjNew)
+			{
+				CAutoP<CWStringBase> a_pstr;
+				a_pstr = pmdp->GetMDObjDXLStr(m_mp, this, mdid);
+
+				GPOS_ASSERT(NULL != a_pstr.Value());
+
+				pmdobjNew = gpdxl::CDXLUtils::ParseDXLToIMDIdCacheObj(mp, a_pstr.Value(), NULL /* XSD path */);
+			}
 			GPOS_ASSERT(NULL != pmdobjNew);
 
 			if (fPrintOptStats)
@@ -1280,23 +1294,26 @@ CMDAccessor::GetHistogram
 	GPOS_ASSERT(NULL != pmdcolstats);
 
 	BOOL is_col_stats_missing = pmdcolstats->IsColStatsMissing();
-	const ULONG num_of_buckets = pmdcolstats->Buckets();
 	BOOL fBoolType = CMDAccessorUtils::FBoolType(this, mdid_type);
 	if (is_col_stats_missing && fBoolType)
 	{
-		GPOS_ASSERT(0 == num_of_buckets);
+		GPOS_ASSERT(0 == pmdcolstats->Buckets());
 
 		return CHistogram::MakeDefaultBoolHistogram(mp);
 	}
 
-	CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp);
-	for (ULONG ul = 0; ul < num_of_buckets; ul++)
+	if (!GPOS_FTRACE(EopttraceEagerHistogramMaterialization))
 	{
-		const CDXLBucket *dxl_bucket = pmdcolstats->GetDXLBucketAt(ul);
-		CBucket *bucket = Pbucket(mp, mdid_type, dxl_bucket);
-		buckets->Append(bucket);
+		// buckets are constructed only once a predicate or operator needs them;
+		// the column stats and type objects stay pinned by this accessor
+		CHistogram *histogram = GPOS_NEW(mp) CHistogram(mp, this, mdid_type, pmdcolstats);
+		GPOS_ASSERT_IMP(fBoolType, 3 >= histogram->GetNumDistinct() - CStatistics::Epsilon);
+
+		return histogram;
 	}
 
+	CBucketArray *buckets = GetBucketArray(mp, mdid_type, pmdcolstats);
+
 	CDouble null_freq = pmdcolstats->GetNullFreq();
 	CDouble distinct_remaining = pmdcolstats->GetDistinctRemain();
 	CDouble freq_remaining = pmdcolstats->GetFreqRemain();
@@ -1315,6 +1332,37 @@ CMDAccessor::GetHistogram
 	return histogram;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::GetBucketArray
+//
+//	@doc:
+//		Construct the typed buckets of the given MD column stats object
+//
+//---------------------------------------------------------------------------
+CBucketArray *
+CMDAccessor::GetBucketArray
+	(
+	IMemoryPool *mp,
+	IMDId *mdid_type,
+	const IMDColStats *pmdcolstats
+	)
+{
+	GPOS_ASSERT(NULL != mdid_type);
+	GPOS_ASSERT(NULL != pmdcolstats);
+
+	const ULONG num_of_buckets = pmdcolstats->Buckets();
+	CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp);
+	for (ULONG ul = 0; ul < num_of_buckets; ul++)
+	{
+		const CDXLBucket *dxl_bucket = pmdcolstats->GetDXLBucketAt(ul);
+		CBucket *bucket = Pbucket(mp, mdid_type, dxl_bucket);
+		buckets->Append(bucket);
+	}
+
+	return buckets;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessor::Pbucket
@@ -9,6 +9,7 @@
 //		 Function implementation of CMDCache
 //---------------------------------------------------------------------------
 
+#include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/task/CAutoTraceFlag.h"
 
 #include "gpopt/mdcache/CMDCache.h"
@@ -24,6 +25,9 @@ CMDAccessor::MDCache *CMDCache::m_pcache = NULL;
 // maximum size of the cache
 ULLONG CMDCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
 
+// persisted snapshot of metadata objects
+CMDSnapshot *CMDCache::m_pmdsnap = NULL;
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDCache::Init
@@ -37,7 +41,9 @@ CMDCache::Init()
 {
 	GPOS_ASSERT(NULL == m_pcache && "Metadata cache was already created");
 
-	m_pcache = CCacheFactory::CreateCache<IMDCacheObject*, CMDKey*>
+	// cache is shared by concurrent optimizations, use independently
+	// evicting shards to reduce contention
+	m_pcache = CCacheFactory::CreateShardedCache<IMDCacheObject*, CMDKey*>
 					(
 					true /*fUnique*/,
 					m_ullCacheQuota,
@@ -63,6 +69,66 @@ CMDCache::Shutdown()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::LoadSnapshot
+//
+//	@doc:
+//		Map snapshot file and consult it on subsequent cache misses; the
+//		snapshot survives cache resets until it is dropped
+//
+//---------------------------------------------------------------------------
+void
+CMDCache::LoadSnapshot
+	(
+	const CHAR *szFileName
+	)
+{
+	GPOS_ASSERT(NULL == m_pmdsnap && "Metadata snapshot was already loaded");
+
+	IMemoryPool *mp = CCacheFactory::GetFactory()->Pmp();
+	m_pmdsnap = GPOS_NEW(mp) CMDSnapshot(mp, szFileName);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::UlSaveSnapshot
+//
+//	@doc:
+//		Persist cache contents to a snapshot file
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDCache::UlSaveSnapshot
+	(
+	const CHAR *szFileName
+	)
+{
+	GPOS_ASSERT(NULL != m_pcache && "Metadata cache was not created");
+
+	CAutoMemoryPool amp;
+	return CMDSnapshot::UlSave(amp.Pmp(), m_pcache, szFileName);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::DropSnapshot
+//
+//	@doc:
+//		Stop consulting the loaded snapshot; must not be called while
+//		optimizations are running
+//
+//---------------------------------------------------------------------------
+void
+CMDCache::DropSnapshot()
+{
+	GPOS_DELETE(m_pmdsnap);
+	m_pmdsnap = NULL;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDCache::SetCacheQuota
@@ -0,0 +1,427 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CMDSnapshot.cpp
+//
+//	@doc:
+//		Implementation of persistent metadata cache snapshots
+//---------------------------------------------------------------------------
+
+#include <fcntl.h>
+
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRef.h"
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/io/CFileWriter.h"
+#include "gpos/io/ioutils.h"
+#include "gpos/string/CStringStatic.h"
+#include "gpos/sync/atomic.h"
+
+#include "gpopt/mdcache/CMDSnapshot.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/exception.h"
+
+using namespace gpos;
+using namespace gpmd;
+using namespace gpdxl;
+using namespace gpopt;
+
+// magic number at the end of snapshot files
+#define GPOPT_MDSNAPSHOT_MAGIC (((ULLONG) 0x47504F52 << 32) | 0x4D445331)
+
+// current format version of snapshot files
+#define GPOPT_MDSNAPSHOT_VERSION 1
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::CMDSnapshot
+//
+//	@doc:
+//		Ctor; maps the given snapshot file into memory and indexes it
+//
+//---------------------------------------------------------------------------
+CMDSnapshot::CMDSnapshot
+	(
+	IMemoryPool *mp,
+	const CHAR *szFileName
+	)
+	:
+	m_mp(mp),
+	m_pbData(NULL),
+	m_ullSize(0),
+	m_ulEntries(0),
+	m_phmmdidentry(NULL),
+	m_ulpHits(0)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != szFileName);
+
+	INT iFd = ioutils::OpenFile(szFileName, O_RDONLY, 0 /*permission_bits*/);
+	if (0 > iFd)
+	{
+		GPOS_RAISE(CException::ExmaSystem, CException::ExmiIOError, errno);
+	}
+
+	GPOS_TRY
+	{
+		m_ullSize = ioutils::FileSize(iFd);
+		if (sizeof(STrailer) > m_ullSize)
+		{
+			GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported, GPOS_WSZ_LIT("Metadata snapshot is truncated"));
+		}
+
+		m_pbData = static_cast<const BYTE *>(ioutils::MapFile(iFd, m_ullSize));
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		(void) ioutils::CloseFile(iFd);
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+
+	// mapping remains valid after closing the file
+	(void) ioutils::CloseFile(iFd);
+
+	GPOS_TRY
+	{
+		LoadIndex();
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		CRefCount::SafeRelease(m_phmmdidentry);
+		ioutils::UnmapFile(m_pbData, m_ullSize);
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::~CMDSnapshot
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMDSnapshot::~CMDSnapshot()
+{
+	m_phmmdidentry->Release();
+	ioutils::UnmapFile(m_pbData, m_ullSize);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::HashMDId
+//
+//	@doc:
+//		Hash function of mdid strings
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDSnapshot::HashMDId
+	(
+	const CHAR *szMDId
+	)
+{
+	return gpos::HashByteArray((const BYTE *) szMDId, clib::Strlen(szMDId));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::FEqualMDId
+//
+//	@doc:
+//		Equality function of mdid strings
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDSnapshot::FEqualMDId
+	(
+	const CHAR *szMDIdFst,
+	const CHAR *szMDIdSnd
+	)
+{
+	return 0 == clib::Strcmp(szMDIdFst, szMDIdSnd);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::LoadIndex
+//
+//	@doc:
+//		Verify trailer and index of mapped file and build lookup map;
+//		all offsets are checked to point into the string area, which must
+//		end with a NUL so that no string runs past it
+//
+//---------------------------------------------------------------------------
+void
+CMDSnapshot::LoadIndex()
+{
+	STrailer trailer;
+	clib::Memcpy(&trailer, m_pbData + m_ullSize - sizeof(STrailer), sizeof(STrailer));
+
+	const ULLONG ullIndexSize = (ULLONG) trailer.m_ulEntries * sizeof(SEntry);
+	if (GPOPT_MDSNAPSHOT_MAGIC != trailer.m_ullMagic ||
+		GPOPT_MDSNAPSHOT_VERSION != trailer.m_ulVersion ||
+		trailer.m_ullIndexOffset + ullIndexSize + sizeof(STrailer) != m_ullSize ||
+		(0 < trailer.m_ullIndexOffset && '\0' != m_pbData[trailer.m_ullIndexOffset - 1]))
+	{
+		GPOS_RAISE
+			(
+			gpdxl::ExmaMD,
+			gpdxl::ExmiMDObjUnsupported,
+			GPOS_WSZ_LIT("Metadata snapshot is corrupt or of an unsupported version")
+			);
+	}
+
+	m_phmmdidentry = GPOS_NEW(m_mp) MDIdToEntryMap(m_mp);
+
+	SEntry *pentry = (SEntry *) (m_pbData + trailer.m_ullIndexOffset);
+	for (ULONG ul = 0; ul < trailer.m_ulEntries; ul++, pentry++)
+	{
+		if (pentry->m_ullMDIdOffset >= trailer.m_ullIndexOffset ||
+			pentry->m_ullDXLOffset >= trailer.m_ullIndexOffset)
+		{
+			GPOS_RAISE
+				(
+				gpdxl::ExmaMD,
+				gpdxl::ExmiMDObjUnsupported,
+				GPOS_WSZ_LIT("Metadata snapshot is corrupt or of an unsupported version")
+				);
+		}
+
+		// later entries with a duplicate mdid are ignored
+		CHAR *szMDId = (CHAR *) (m_pbData + pentry->m_ullMDIdOffset);
+		if (m_phmmdidentry->Insert(szMDId, pentry))
+		{
+			m_ulEntries++;
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::PimdobjLookup
+//
+//	@doc:
+//		Parse object with the given mdid from the snapshot into the given
+//		memory pool; returns NULL if the snapshot does not have the object
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *
+CMDSnapshot::PimdobjLookup
+	(
+	IMemoryPool *mp,
+	const IMDId *mdid
+	)
+{
+	GPOS_ASSERT(NULL != mdid);
+
+	CAutoRg<CHAR> a_szMDId;
+	a_szMDId = CDXLUtils::CreateMultiByteCharStringFromWCString(m_mp, mdid->GetBuffer());
+
+	const SEntry *pentry = m_phmmdidentry->Find(a_szMDId.Rgt());
+	if (NULL == pentry)
+	{
+		return NULL;
+	}
+
+	IMDCacheObject *pmdobj = CDXLUtils::ParseDXLToIMDIdCacheObj
+									(
+									mp,
+									(const CHAR *) (m_pbData + pentry->m_ullDXLOffset),
+									NULL /*xsd_file_path*/
+									);
+
+	if (NULL != pmdobj)
+	{
+		(void) ExchangeAddUlongPtrWithInt(&m_ulpHits, 1);
+	}
+
+	return pmdobj;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::AppendObject
+//
+//	@doc:
+//		Serialize a metadata object and append its mdid and DXL strings to
+//		the string array passed as context
+//
+//---------------------------------------------------------------------------
+void
+CMDSnapshot::AppendObject
+	(
+	IMDCacheObject *pmdobj,
+	void *pv
+	)
+{
+	GPOS_ASSERT(NULL != pmdobj);
+	GPOS_ASSERT(NULL != pv);
+
+	SAppendContext *pac = static_cast<SAppendContext *>(pv);
+	IMemoryPool *mp = pac->m_mp;
+
+	CAutoP<CWStringDynamic> a_pstrDXL;
+	a_pstrDXL = CDXLUtils::SerializeMDObj(mp, pmdobj, true /*serialize_header_footer*/, false /*indentation*/);
+
+	CAutoRg<CHAR> a_szMDId;
+	a_szMDId = CDXLUtils::CreateMultiByteCharStringFromWCString(mp, pmdobj->MDId()->GetBuffer());
+	CAutoRg<CHAR> a_szDXL;
+	a_szDXL = CDXLUtils::CreateMultiByteCharStringFromWCString(mp, a_pstrDXL->GetBuffer());
+
+	pac->m_pdrgpsz->Append(a_szMDId.RgtReset());
+	pac->m_pdrgpsz->Append(a_szDXL.RgtReset());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::UlWrite
+//
+//	@doc:
+//		Write pairs of mdid and DXL strings to a snapshot file; the string
+//		area is padded so that the index is aligned, and the file is written
+//		under a temporary name and moved into place when complete
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDSnapshot::UlWrite
+	(
+	IMemoryPool *mp,
+	StringArray *pdrgpsz,
+	const CHAR *szFileName
+	)
+{
+	GPOS_ASSERT(NULL != pdrgpsz);
+	GPOS_ASSERT(NULL != szFileName);
+	GPOS_ASSERT(0 == pdrgpsz->Size() % 2);
+
+	const ULONG ulEntries = pdrgpsz->Size() / 2;
+
+	CHAR szTmpFileName[GPOS_FILE_NAME_BUF_SIZE];
+	CStringStatic strTmpFileName(szTmpFileName, GPOS_ARRAY_SIZE(szTmpFileName));
+	strTmpFileName.AppendFormat("%s.tmp", szFileName);
+
+	CAutoRg<SEntry> a_rgentry;
+	a_rgentry = GPOS_NEW_ARRAY(mp, SEntry, ulEntries + 1);
+
+	CFileWriter fw;
+	fw.Open(strTmpFileName.Buffer(), S_IRUSR | S_IWUSR);
+
+	ULLONG ullOffset = 0;
+	for (ULONG ul = 0; ul < ulEntries; ul++)
+	{
+		const CHAR *szMDId = (*pdrgpsz)[2 * ul];
+		const CHAR *szDXL = (*pdrgpsz)[2 * ul + 1];
+		const ULONG ulMDIdSize = clib::Strlen(szMDId) + 1;
+		const ULONG ulDXLSize = clib::Strlen(szDXL) + 1;
+
+		a_rgentry[ul].m_ullMDIdOffset = ullOffset;
+		a_rgentry[ul].m_ullDXLOffset = ullOffset + ulMDIdSize;
+
+		fw.Write((const BYTE *) szMDId, ulMDIdSize);
+		fw.Write((const BYTE *) szDXL, ulDXLSize);
+		ullOffset += ulMDIdSize + ulDXLSize;
+	}
+
+	const BYTE rgbPadding[GPOS_SIZEOF(ULLONG)] = {0};
+	const ULONG ulPadding = (ULONG) ((GPOS_SIZEOF(ULLONG) - ullOffset % GPOS_SIZEOF(ULLONG)) % GPOS_SIZEOF(ULLONG));
+	if (0 < ulPadding)
+	{
+		fw.Write(rgbPadding, ulPadding);
+		ullOffset += ulPadding;
+	}
+
+	if (0 < ulEntries)
+	{
+		fw.Write((const BYTE *) a_rgentry.Rgt(), ulEntries * sizeof(SEntry));
+	}
+
+	STrailer trailer;
+	trailer.m_ullMagic = GPOPT_MDSNAPSHOT_MAGIC;
+	trailer.m_ullIndexOffset = ullOffset;
+	trailer.m_ulEntries = ulEntries;
+	trailer.m_ulVersion = GPOPT_MDSNAPSHOT_VERSION;
+	fw.Write((const BYTE *) &trailer, sizeof(trailer));
+
+	fw.Close();
+
+	// readers never see a partially written snapshot
+	ioutils::Move(strTmpFileName.Buffer(), szFileName);
+
+	return ulEntries;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::UlSave
+//
+//	@doc:
+//		Persist an array of metadata objects
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDSnapshot::UlSave
+	(
+	IMemoryPool *mp,
+	const IMDCacheObjectArray *pdrgpmdobj,
+	const CHAR *szFileName
+	)
+{
+	GPOS_ASSERT(NULL != pdrgpmdobj);
+
+	CAutoRef<StringArray> a_pdrgpsz(GPOS_NEW(mp) StringArray(mp));
+	SAppendContext ac = {mp, a_pdrgpsz.Value()};
+
+	const ULONG ulObjects = pdrgpmdobj->Size();
+	for (ULONG ul = 0; ul < ulObjects; ul++)
+	{
+		AppendObject((*pdrgpmdobj)[ul], &ac);
+	}
+
+	return UlWrite(mp, a_pdrgpsz.Value(), szFileName);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDSnapshot::UlSave
+//
+//	@doc:
+//		Persist contents of a metadata cache; objects are serialized while
+//		visiting the cache, the file is written after all bucket locks are
+//		released
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDSnapshot::UlSave
+	(
+	IMemoryPool *mp,
+	CMDAccessor::MDCache *pcache,
+	const CHAR *szFileName
+	)
+{
+	GPOS_ASSERT(NULL != pcache);
+
+	CAutoRef<StringArray> a_pdrgpsz(GPOS_NEW(mp) StringArray(mp));
+	SAppendContext ac = {mp, a_pdrgpsz.Value()};
+	pcache->Visit(AppendObject, &ac);
+
+	return UlWrite(mp, a_pdrgpsz.Value(), szFileName);
+}
+
+// EOF
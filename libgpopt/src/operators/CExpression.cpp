@@ -759,6 +759,28 @@ CExpression::ResetStats()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpression::AttachStats
+//
+//	@doc:
+//		Attach stats derived on an identical expression
+//
+//---------------------------------------------------------------------------
+void
+CExpression::AttachStats
+	(
+	IStatistics *stats
+	)
+{
+	GPOS_ASSERT(NULL != stats);
+	GPOS_ASSERT(NULL == m_pstats);
+
+	stats->AddRef();
+	m_pstats = stats;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CExpression::HasOuterRefs
@@ -10,10 +10,12 @@
 //---------------------------------------------------------------------------
 
 #include "gpos/base.h"
+#include "gpos/sync/CAutoMutex.h"
 
 #include "gpopt/base/CColumnFactory.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/operators/CLogicalNAryJoin.h"
+#include "gpopt/xforms/CJoinStatsCache.h"
 #include "naucrates/statistics/CStatisticsUtils.h"
 
 using namespace gpopt;
@@ -32,12 +34,52 @@ CLogicalNAryJoin::CLogicalNAryJoin
 	IMemoryPool *mp
 	)
 	:
-	CLogicalJoin(mp)
+	CLogicalJoin(mp),
+	m_pjsc(NULL)
 {
 	GPOS_ASSERT(NULL != mp);
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CLogicalNAryJoin::~CLogicalNAryJoin
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CLogicalNAryJoin::~CLogicalNAryJoin()
+{
+	CRefCount::SafeRelease(m_pjsc);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CLogicalNAryJoin::Pjsc
+//
+//	@doc:
+//		Stats of joins built by the join order xforms expanding this join;
+//		the xforms of a memo group expression share its operator, so they
+//		reuse the stats derived by each other
+//
+//---------------------------------------------------------------------------
+CJoinStatsCache *
+CLogicalNAryJoin::Pjsc()
+{
+	CAutoMutex am(m_mutex);
+	am.Lock();
+
+	if (NULL == m_pjsc)
+	{
+		m_pjsc = GPOS_NEW(m_mp) CJoinStatsCache(m_mp);
+	}
+
+	return m_pjsc;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CLogicalNAryJoin::Maxcard
@@ -35,7 +35,9 @@ COptimizerConfig::COptimizerConfig
 	CCTEConfig *pcteconf,
 	ICostModel *cost_model,
 	CHint *phint,
-	CWindowOids *pwindowoids
+	CWindowOids *pwindowoids,
+	CSchedulerConfig *psched_conf,
+	ULONG ulOptimizationBudget
 	)
 	:
 	m_enumerator_cfg(pec),
@@ -43,7 +45,9 @@ COptimizerConfig::COptimizerConfig
 	m_cte_conf(pcteconf),
 	m_cost_model(cost_model),
 	m_hint(phint),
-	m_window_oids(pwindowoids)
+	m_window_oids(pwindowoids),
+	m_sched_conf(psched_conf),
+	m_ulOptimizationBudget(ulOptimizationBudget)
 {
 	GPOS_ASSERT(NULL != pec);
 	GPOS_ASSERT(NULL != stats_config);
@@ -51,6 +55,7 @@ COptimizerConfig::COptimizerConfig
 	GPOS_ASSERT(NULL != m_cost_model);
 	GPOS_ASSERT(NULL != phint);
 	GPOS_ASSERT(NULL != m_window_oids);
+	GPOS_ASSERT(NULL != m_sched_conf);
 }
 
 //---------------------------------------------------------------------------
@@ -69,6 +74,7 @@ COptimizerConfig::~COptimizerConfig()
 	m_cost_model->Release();
 	m_hint->Release();
 	m_window_oids->Release();
+	m_sched_conf->Release();
 }
 
 //---------------------------------------------------------------------------
@@ -92,7 +98,8 @@ COptimizerConfig::PoconfDefault
 						CCTEConfig::PcteconfDefault(mp),
 						ICostModel::PcmDefault(mp),
 						CHint::PhintDefault(mp),
-						CWindowOids::GetWindowOids(mp)
+						CWindowOids::GetWindowOids(mp),
+						CSchedulerConfig::PschedconfDefault(mp)
 						);
 }
 
@@ -120,10 +127,70 @@ COptimizerConfig::PoconfDefault
 						CCTEConfig::PcteconfDefault(mp),
 						pcm,
 						CHint::PhintDefault(mp),
-						CWindowOids::GetWindowOids(mp)
+						CWindowOids::GetWindowOids(mp),
+						CSchedulerConfig::PschedconfDefault(mp)
 						);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizerConfig::GetSchedulingPolicyStr
+//
+//	@doc:
+//		DXL name of the given scheduling policy
+//
+//---------------------------------------------------------------------------
+const CWStringConst *
+COptimizerConfig::GetSchedulingPolicyStr
+	(
+	CSchedulerConfig::ESchedulingPolicy esp
+	)
+{
+	switch (esp)
+	{
+		case CSchedulerConfig::EspSharedQueue:
+			return CDXLTokens::GetDXLTokenStr(EdxltokenSchedulingPolicySharedQueue);
+
+		case CSchedulerConfig::EspWorkStealing:
+			return CDXLTokens::GetDXLTokenStr(EdxltokenSchedulingPolicyWorkStealing);
+
+		case CSchedulerConfig::EspPriority:
+			return CDXLTokens::GetDXLTokenStr(EdxltokenSchedulingPolicyPriority);
+
+		default:
+			GPOS_ASSERT(!"Unrecognized scheduling policy");
+			return NULL;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizerConfig::GetWorkerPolicyStr
+//
+//	@doc:
+//		DXL name of the given worker policy
+//
+//---------------------------------------------------------------------------
+const CWStringConst *
+COptimizerConfig::GetWorkerPolicyStr
+	(
+	CSchedulerConfig::EWorkerPolicy ewp
+	)
+{
+	switch (ewp)
+	{
+		case CSchedulerConfig::EwpQueuedRunningRatio:
+			return CDXLTokens::GetDXLTokenStr(EdxltokenWorkerPolicyQueuedRunningRatio);
+
+		case CSchedulerConfig::EwpAdaptive:
+			return CDXLTokens::GetDXLTokenStr(EdxltokenWorkerPolicyAdaptive);
+
+		default:
+			GPOS_ASSERT(!"Unrecognized worker policy");
+			return NULL;
+	}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptimizerConfig::Serialize
@@ -140,6 +207,10 @@ COptimizerConfig::Serialize(IMemoryPool *mp, CXMLSerializer *xml_serializer, CBi
 	GPOS_ASSERT(NULL != pbsTrace);
 
 	xml_serializer->OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenOptimizerConfig));
+	if (FBudgeted())
+	{
+		xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenOptimizationBudget), m_ulOptimizationBudget);
+	}
 
 	xml_serializer->OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenEnumeratorConfig));
 	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenPlanId), m_enumerator_cfg->GetPlanId());
@@ -174,6 +245,12 @@ COptimizerConfig::Serialize(IMemoryPool *mp, CXMLSerializer *xml_serializer, CBi
 	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenEnforceConstraintsOnDML), m_hint->FEnforceConstraintsOnDML());
 	xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenHint));
 
+	xml_serializer->OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenSchedulerConfig));
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenSchedulingPolicy), GetSchedulingPolicyStr(m_sched_conf->Esp()));
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenWorkerPolicy), GetWorkerPolicyStr(m_sched_conf->Ewp()));
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenSchedulerWorkers), m_sched_conf->UlWorkers());
+	xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenSchedulerConfig));
+
 	// Serialize traceflags represented in bitset into stream
 	gpos::CBitSetIter bsi(*pbsTrace);
 	CWStringDynamic wsTraceFlags(mp);
@@ -34,6 +34,7 @@ CJob::Reset()
 	m_pjq = NULL;
 	m_ulpRefs = 0;
 	m_fInit = false;
+	m_ulPriority = gpos::ulong_max;
 #ifdef GPOS_DEBUG
 	m_ejs = EjsInit;
 #endif // GPOS_DEBUG
@@ -10,6 +10,7 @@
 //---------------------------------------------------------------------------
 
 #include "gpopt/search/CGroupExpression.h"
+#include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CLogical.h"
 #include "gpopt/search/CJobFactory.h"
 #include "gpopt/search/CJobGroupExpression.h"
@@ -52,7 +53,10 @@ CJobGroupExpression::Init
 //		CJobGroupExpression::ScheduleTransformations
 //
 //	@doc:
-//		Schedule transformation jobs for the given set of xforms
+//		Schedule transformation jobs for the given set of xforms;
+//		under the priority scheduling policy, the promise of each xform is
+//		computed upfront to order the jobs, and xforms that must not be
+//		used are not scheduled at all
 //
 //---------------------------------------------------------------------------
 void
@@ -62,12 +66,33 @@ CJobGroupExpression::ScheduleTransformations
 	CXformSet *xform_set
 	)
 {
+	const BOOL fPriority = CSchedulerConfig::EspPriority == psc->Psched()->Esp();
+
+	CExpressionHandle exprhdl(psc->GetGlobalMemoryPool());
+	if (fPriority)
+	{
+		exprhdl.Attach(m_pgexpr);
+		exprhdl.DeriveProps(NULL /*pdpctxt*/);
+	}
+
 	// iterate on xforms
 	CXformSetIter xsi(*(xform_set));
 	while (xsi.Advance())
 	{
 		CXform *pxform = CXformFactory::Pxff()->Pxf(xsi.TBit());
-		CJobTransformation::ScheduleJob(psc, m_pgexpr, pxform, this);
+
+		// promise is only needed to order jobs by priority
+		CXform::EXformPromise exfp = CXform::ExfpHigh;
+		if (fPriority)
+		{
+			exfp = pxform->Exfp(exprhdl);
+			if (CXform::ExfpNone == exfp)
+			{
+				continue;
+			}
+		}
+
+		CJobTransformation::ScheduleJob(psc, m_pgexpr, pxform, exfp, this);
 	}
 }
 
@@ -347,7 +347,7 @@ CJobGroupExpressionExploration::ScheduleJob
 	// initialize job
 	CJobGroupExpressionExploration *pjege = PjConvert(pj);
 	pjege->Init(pgexpr);
-	psc->Psched()->Add(pjege, pjParent);
+	psc->Psched()->Add(pjege, pjParent, psc);
 }
 
 #ifdef GPOS_DEBUG
@@ -331,6 +331,12 @@ CJobGroupExpressionOptimization::EevtInitialize
 	// get a job pointer
 	CJobGroupExpressionOptimization *pjgeo = PjConvert(pjOwner);
 
+	if (psc->Peng()->FSkipAlternative(pjgeo->m_poc))
+	{
+		// optimization budget ran out, and a plan was already found under this context
+		return eevFinalized;
+	}
+
 	CExpressionHandle exprhdl(psc->GetGlobalMemoryPool());
 	exprhdl.Attach(pjgeo->m_pgexpr);
 	exprhdl.DeriveProps(NULL /*pdpctxt*/);
@@ -751,7 +757,7 @@ CJobGroupExpressionOptimization::ScheduleJob
 	// initialize job
 	CJobGroupExpressionOptimization *pjgeo = PjConvert(pj);
 	pjgeo->Init(pgexpr, poc, ulOptReq);
-	psc->Psched()->Add(pjgeo, pjParent);
+	psc->Psched()->Add(pjgeo, pjParent, psc);
 }
 
 
@@ -810,7 +816,7 @@ CJobGroupExpressionOptimization::FScheduleCTEOptimization
 
 	// initialize job
 	pjgeo->Init(pgexpr, poc, ulOptReq, prppCTEProducer);
-	psc->Psched()->Add(pjgeo, pjParent);
+	psc->Psched()->Add(pjgeo, pjParent, psc);
 	prppCTEProducer->Release();
 
 	return true;
@@ -319,7 +319,7 @@ CJobGroupImplementation::ScheduleJob
 	// initialize job
 	CJobGroupImplementation *pjgi = PjConvert(pj);
 	pjgi->Init(pgroup);
-	psc->Psched()->Add(pjgi, pjParent);
+	psc->Psched()->Add(pjgi, pjParent, psc);
 }
 
 
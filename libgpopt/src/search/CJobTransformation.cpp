@@ -195,6 +195,7 @@ CJobTransformation::ScheduleJob
 	CSchedulerContext *psc,
 	CGroupExpression *pgexpr,
 	CXform *pxform,
+	CXform::EXformPromise exfp,
 	CJob *pjParent
 	)
 {
@@ -203,7 +204,8 @@ CJobTransformation::ScheduleJob
 	// initialize job
 	CJobTransformation *pjt = PjConvert(pj);
 	pjt->Init(pgexpr, pxform);
-	psc->Psched()->Add(pjt, pjParent);
+	pjt->SetPriority(exfp);
+	psc->Psched()->Add(pjt, pjParent, psc);
 }
 
 #ifdef GPOS_DEBUG
@@ -33,7 +33,13 @@
 
 using namespace gpopt;
 
-#define GPOPT_MEMO_HT_BUCKETS	50000
+// number of lock stripes in memo hash table
+#define GPOPT_MEMO_HT_STRIPES	1000
+
+// initial number of buckets per stripe, stripes grow on demand; the initial
+// table size determines the order in which FRehash visits group expressions,
+// and thereby which of two duplicates survives, and is kept at 50000 buckets
+#define GPOPT_MEMO_HT_STRIPE_BUCKETS	50
 			
 //---------------------------------------------------------------------------
 //	@function:
@@ -58,7 +64,8 @@ CMemo::CMemo
 	m_sht.Init
 		(
 		mp,
-		GPOPT_MEMO_HT_BUCKETS,
+		GPOPT_MEMO_HT_STRIPES,
+		GPOPT_MEMO_HT_STRIPE_BUCKETS,
 		GPOS_OFFSET(CGroupExpression, m_linkMemo),
 		0, /*cKeyOffset (0 because we use CGroupExpression class as key)*/
 		&(CGroupExpression::m_gexprInvalid),
@@ -523,21 +530,8 @@ CMemo::FRehash()
 	CList<CGroupExpression> listGExprs;
 	listGExprs.Init(GPOS_OFFSET(CGroupExpression, m_linkMemo));
 
-	ShtIter shtit(m_sht);
-	CGroupExpression *pgexpr = NULL;
-	while (NULL != pgexpr || shtit.Advance())
-	{
-		{
-			ShtAccIter shtitacc(shtit);
-			pgexpr = shtitacc.Value();
-			if (NULL != pgexpr)
-			{
-				shtitacc.Remove(pgexpr);
-				listGExprs.Append(pgexpr);
-			}
-		}
-		GPOS_CHECK_ABORT;
-	}
+	m_sht.RemoveAll(&listGExprs);
+	GPOS_CHECK_ABORT;
 
 	// iterate on list and insert non-duplicate group expressions
 	// back to memo hash table
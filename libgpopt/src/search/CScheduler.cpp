@@ -11,7 +11,9 @@
 
 #include "gpos/base.h"
 
+#include "gpos/common/CWallClock.h"
 #include "gpos/sync/CAutoMutex.h"
+#include "gpos/sync/CAutoSpinlock.h"
 
 #include "gpopt/search/CJob.h"
 #include "gpopt/search/CJobFactory.h"
@@ -35,7 +37,9 @@ CScheduler::CScheduler
 	(
 	IMemoryPool *mp,
 	ULONG ulJobs,
-	ULONG_PTR ulpTasks
+	ULONG_PTR ulpTasks,
+	CSchedulerConfig::ESchedulingPolicy esp,
+	CSchedulerConfig::EWorkerPolicy ewp
 #ifdef GPOS_DEBUG
 	,
 	BOOL fTrackingJobs
@@ -43,6 +47,10 @@ CScheduler::CScheduler
 	)
 	:
 	m_spjl(mp, ulJobs),
+	m_esp(esp),
+	m_rgjd(NULL),
+	m_pjh(NULL),
+	m_ewp(ewp),
 	m_ulpTasksMax(ulpTasks),
 	m_ulpTasksActive(0),
 	m_ulpTotal(0),
@@ -53,7 +61,10 @@ CScheduler::CScheduler
 	m_ulpStatsSuspended(0),
 	m_ulpStatsCompleted(0),
 	m_ulpStatsCompletedQueued(0),
-	m_ulpStatsResumed(0)
+	m_ulpStatsResumed(0),
+	m_ulpStatsStolen(0),
+	m_ulpStatsWakeups(0),
+	m_ulpStatsRetired(0)
 #ifdef GPOS_DEBUG
 	,
 	m_fTrackingJobs(fTrackingJobs)
@@ -64,6 +75,36 @@ CScheduler::CScheduler
 
 	// initialize list of waiting new jobs
 	m_listjlWaiting.Init(GPOS_OFFSET(SJobLink, m_link));
+
+	// initialize per job type counters
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		m_rgulpQueued[ul] = 0;
+		m_rgulpStatsExecuted[ul] = 0;
+		m_rgulpStatsExecTimeUS[ul] = 0;
+	}
+
+	// initialize per-worker job deques
+	if (CSchedulerConfig::EspWorkStealing == m_esp)
+	{
+		m_rgjd = GPOS_NEW_ARRAY(mp, SJobDeque, m_ulpTasksMax);
+		for (ULONG_PTR ulp = 0; ulp < m_ulpTasksMax; ulp++)
+		{
+			m_rgjd[ulp].m_listjl.Init(GPOS_OFFSET(SJobLink, m_link));
+		}
+	}
+
+	// initialize heap of runnable jobs
+	if (CSchedulerConfig::EspPriority == m_esp)
+	{
+		m_pjh = GPOS_NEW(mp) SJobHeap();
+		m_pjh->m_mp = mp;
+		m_pjh->m_ulCapacity = std::max(ulJobs, (ULONG) 1);
+		m_pjh->m_rgpjl = GPOS_NEW_ARRAY(mp, SJobLink*, m_pjh->m_ulCapacity);
+		m_pjh->m_ulSize = 0;
+		m_pjh->m_ullRound = 0;
+		m_pjh->m_ullSeq = 0;
+	}
 	
 	// initialize event for job queue
 	m_event.Init(&m_mutex);
@@ -95,6 +136,16 @@ CScheduler::~CScheduler()
 		);
 
 	GPOS_ASSERT(0 == m_event.GetNumWaiters());
+
+	GPOS_DELETE_ARRAY(m_rgjd);
+
+	if (NULL != m_pjh)
+	{
+		GPOS_ASSERT_IMP(!ITask::Self()->HasPendingExceptions(), 0 == m_pjh->m_ulSize);
+
+		GPOS_DELETE_ARRAY(m_pjh->m_rgpjl);
+		GPOS_DELETE(m_pjh);
+	}
 }
 
 
@@ -137,10 +188,11 @@ CScheduler::ProcessJobs
 	{
 		IncTasksActive();
 
-		// execute waiting jobs
-		ExecuteJobs(psc);
-
-		DecrTasksActive();
+		// execute waiting jobs; a retired worker has already left the active set
+		if (!FExecuteJobs(psc))
+		{
+			DecrTasksActive();
+		}
 
 		CAutoMutex am(m_mutex);
 		am.Lock();
@@ -162,15 +214,16 @@ CScheduler::ProcessJobs
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CScheduler::ExecuteJobs
+//		CScheduler::FExecuteJobs
 //
 //	@doc:
 // 		Job processing loop;
-//		keeps executing jobs as long as there is work queued;
+//		keeps executing jobs as long as there is work queued; returns true
+//		if the worker retired while there was still work queued
 //
 //---------------------------------------------------------------------------
-void
-CScheduler::ExecuteJobs
+BOOL
+CScheduler::FExecuteJobs
 	(
 	CSchedulerContext *psc
 	)
@@ -179,13 +232,24 @@ CScheduler::ExecuteJobs
 	ULONG count = 0;
 
 	// keep retrieving jobs
-	while (NULL != (pj = PjRetrieve()))
+	while (NULL != (pj = PjRetrieve(psc)))
 	{
 		// prepare for job execution
 		PreExecute(pj);
 
 		// execute job
-		BOOL fCompleted = FExecute(pj, psc);
+		BOOL fCompleted = false;
+		if (FAdaptive())
+		{
+			const CJob::EJobType ejt = pj->Ejt();
+			CWallClock clock;
+			fCompleted = FExecute(pj, psc);
+			RecordExecution(ejt, clock.ElapsedUS());
+		}
+		else
+		{
+			fCompleted = FExecute(pj, psc);
+		}
 
 #ifdef GPOS_DEBUG
 		// restrict parallelism to keep track of jobs
@@ -202,7 +266,7 @@ CScheduler::ExecuteJobs
 		{
 			case EjrCompleted:
 				// job is completed
-				Complete(pj);
+				Complete(pj, psc);
 
 #ifdef GPOS_DEBUG
 				if (GPOS_FTRACE(EopttracePrintJobScheduler))
@@ -220,7 +284,7 @@ CScheduler::ExecuteJobs
 
 			case EjrRunnable:
 				// child jobs have completed, job can immediately resume
-				Resume(pj);
+				Resume(pj, psc);
 				continue;
 
 			case EjrSuspended:
@@ -237,7 +301,15 @@ CScheduler::ExecuteJobs
 			GPOS_CHECK_ABORT;
 			count = 0;
 		}
+
+		// leave remaining work to other active workers
+		if (FAdaptive() && FRetireWorker())
+		{
+			return true;
+		}
 	}
+
+	return false;
 }
 
 
@@ -253,7 +325,8 @@ void
 CScheduler::Add
 	(
 	CJob *pj,
-	CJob *pjParent
+	CJob *pjParent,
+	CSchedulerContext *psc
 	)
 {
 	GPOS_ASSERT(NULL != pj);
@@ -280,7 +353,7 @@ CScheduler::Add
 	// increment total number of jobs
 	(void) ExchangeAddUlongPtrWithInt(&m_ulpTotal, 1);
 
-	Schedule(pj);
+	Schedule(pj, psc);
 }
 
 
@@ -295,13 +368,14 @@ CScheduler::Add
 void
 CScheduler::Resume
 	(
-	CJob *pj
+	CJob *pj,
+	CSchedulerContext *psc
 	)
 {
 	GPOS_ASSERT(NULL != pj);
 	GPOS_ASSERT(0 == pj->UlpRefs());
 
-	Schedule(pj);
+	Schedule(pj, psc);
 }
 
 
@@ -316,7 +390,8 @@ CScheduler::Resume
 void
 CScheduler::Schedule
 	(
-	CJob *pj
+	CJob *pj,
+	CSchedulerContext *psc
 	)
 {
 	GPOS_ASSERT(NULL != pj);
@@ -345,11 +420,32 @@ CScheduler::Schedule
 	}
 #endif // GPOS_DEBUG
 
-	// add to waiting list
-	m_listjlWaiting.Push(pjl);
+	SJobDeque *pjd = PjdLocal(psc);
+	if (NULL != m_pjh)
+	{
+		// add to heap of runnable jobs
+		PushHeap(pjl);
+	}
+	else if (NULL != pjd)
+	{
+		// add to the head of the worker's own deque
+		CAutoSpinlock as(pjd->m_lock);
+		as.Lock();
+
+		pjd->m_listjl.Prepend(pjl);
+	}
+	else
+	{
+		// add to waiting list
+		m_listjlWaiting.Push(pjl);
+	}
 
 	// increment number of queued jobs
 	(void) ExchangeAddUlongPtrWithInt(&m_ulpQueued, 1);
+	if (FAdaptive())
+	{
+		(void) ExchangeAddUlongPtrWithInt(&m_rgulpQueued[pj->Ejt()], 1);
+	}
 
 	// update statistics
 	(void) ExchangeAddUlongPtrWithInt(&m_ulpStatsQueued, 1);
@@ -369,10 +465,172 @@ CScheduler::Schedule
 
 		// wake up worker to pick up a job
 		m_event.Signal();
+
+		(void) ExchangeAddUlongPtrWithInt(&m_ulpStatsWakeups, 1);
 	}
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::UllAvgExecTimeUS
+//
+//	@doc:
+//		Average execution time of given job type; job types that have not
+//		been executed yet are assumed to have a default cost
+//
+//---------------------------------------------------------------------------
+ULLONG
+CScheduler::UllAvgExecTimeUS
+	(
+	CJob::EJobType ejt
+	)
+	const
+{
+	GPOS_ASSERT(CJob::EjtSentinel > ejt);
+
+	const ULONG_PTR ulpExecuted = m_rgulpStatsExecuted[ejt];
+	if (0 == ulpExecuted)
+	{
+		return OPT_SCHED_DEFAULT_JOB_COST_US;
+	}
+
+	return m_rgulpStatsExecTimeUS[ejt] / ulpExecuted;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::UllQueuedCostUS
+//
+//	@doc:
+//		Estimated execution time of queued jobs
+//
+//---------------------------------------------------------------------------
+ULLONG
+CScheduler::UllQueuedCostUS() const
+{
+	ULLONG ullCost = 0;
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		const ULONG_PTR ulpQueued = m_rgulpQueued[ul];
+		if (0 < ulpQueued)
+		{
+			ullCost += ulpQueued * UllAvgExecTimeUS((CJob::EJobType) ul);
+		}
+	}
+
+	return ullCost;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::RecordExecution
+//
+//	@doc:
+//		Record execution time of a job
+//
+//---------------------------------------------------------------------------
+void
+CScheduler::RecordExecution
+	(
+	CJob::EJobType ejt,
+	ULONG ulTimeUS
+	)
+{
+	GPOS_ASSERT(CJob::EjtSentinel > ejt);
+
+	(void) ExchangeAddUlongPtrWithInt(&m_rgulpStatsExecTimeUS[ejt], (INT) ulTimeUS);
+	(void) ExchangeAddUlongPtrWithInt(&m_rgulpStatsExecuted[ejt], 1);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::FIncreaseWorkers
+//
+//	@doc:
+//		Check if there is enough work for more workers
+//
+//---------------------------------------------------------------------------
+BOOL
+CScheduler::FIncreaseWorkers() const
+{
+	GPOS_ASSERT(m_ulpTasksMax >= m_ulpRunning);
+
+	const ULONG_PTR ulpActive = m_ulpTasksActive;
+	if (m_ulpTasksMax <= ulpActive)
+	{
+		return false;
+	}
+
+	if (FAdaptive())
+	{
+		// a new worker must get more work than it costs to wake it up
+		return OPT_SCHED_WAKEUP_COST_US < UllQueuedCostUS() / (ulpActive + 1);
+	}
+
+	return OPT_SCHED_QUEUED_RUNNING_RATIO < m_ulpQueued / (ulpActive + 1);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::FDecreaseWorkers
+//
+//	@doc:
+//		Check if there is too little work for the active workers; uses half
+//		the wakeup cost so that workers do not flip between active and idle
+//
+//---------------------------------------------------------------------------
+BOOL
+CScheduler::FDecreaseWorkers() const
+{
+	GPOS_ASSERT(FAdaptive());
+
+	const ULONG_PTR ulpActive = m_ulpTasksActive;
+
+	return
+		1 < ulpActive &&
+		UllQueuedCostUS() / ulpActive < OPT_SCHED_WAKEUP_COST_US / 2;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::FRetireWorker
+//
+//	@doc:
+//		Leave the set of active workers if there is too little work;
+//		the counter of active tasks is only decremented if another active
+//		worker remains to process queued jobs
+//
+//---------------------------------------------------------------------------
+BOOL
+CScheduler::FRetireWorker()
+{
+	if (!FDecreaseWorkers())
+	{
+		return false;
+	}
+
+	ULONG_PTR ulpActive = m_ulpTasksActive;
+	while (1 < ulpActive)
+	{
+		if (CompareSwap(&m_ulpTasksActive, ulpActive, ulpActive - 1))
+		{
+			(void) ExchangeAddUlongPtrWithInt(&m_ulpStatsRetired, 1);
+			return true;
+		}
+
+		ulpActive = m_ulpTasksActive;
+	}
+
+	return false;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CScheduler::PreExecute
@@ -497,6 +755,250 @@ CScheduler::EjrPostExecute
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::PjdLocal
+//
+//	@doc:
+//		Deque owned by the worker of the given scheduling context;
+//		returns NULL if the scheduler does not use work-stealing or if
+//		the caller is not a scheduler worker
+//
+//---------------------------------------------------------------------------
+CScheduler::SJobDeque *
+CScheduler::PjdLocal
+	(
+	CSchedulerContext *psc
+	)
+	const
+{
+	if (NULL == m_rgjd || NULL == psc)
+	{
+		return NULL;
+	}
+
+	GPOS_ASSERT(psc->UlWorkerId() < m_ulpTasksMax);
+
+	return &m_rgjd[psc->UlWorkerId()];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::PjlPop
+//
+//	@doc:
+//		Pop a job link from the head of the given deque
+//
+//---------------------------------------------------------------------------
+CScheduler::SJobLink *
+CScheduler::PjlPop
+	(
+	SJobDeque *pjd
+	)
+{
+	GPOS_ASSERT(NULL != pjd);
+
+	CAutoSpinlock as(pjd->m_lock);
+	as.Lock();
+
+	if (pjd->m_listjl.IsEmpty())
+	{
+		return NULL;
+	}
+
+	return pjd->m_listjl.RemoveHead();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::PjlSteal
+//
+//	@doc:
+//		Steal a job link from the tail of another worker's deque;
+//		victims are visited round-robin starting after the current worker
+//
+//---------------------------------------------------------------------------
+CScheduler::SJobLink *
+CScheduler::PjlSteal
+	(
+	CSchedulerContext *psc
+	)
+{
+	GPOS_ASSERT(NULL != m_rgjd);
+	GPOS_ASSERT(NULL != psc);
+
+	const ULONG_PTR ulpOwner = psc->UlWorkerId();
+	for (ULONG_PTR ulp = 1; ulp < m_ulpTasksMax; ulp++)
+	{
+		SJobDeque *pjd = &m_rgjd[(ulpOwner + ulp) % m_ulpTasksMax];
+
+		CAutoSpinlock as(pjd->m_lock);
+		as.Lock();
+
+		if (!pjd->m_listjl.IsEmpty())
+		{
+			(void) ExchangeAddUlongPtrWithInt(&m_ulpStatsStolen, 1);
+
+			return pjd->m_listjl.RemoveTail();
+		}
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::FPrecedes
+//
+//	@doc:
+//		Check if the first job link runs before the second one under the
+//		priority policy; jobs of later rounds run first, then jobs with
+//		higher priority, then jobs that were scheduled later
+//
+//---------------------------------------------------------------------------
+BOOL
+CScheduler::FPrecedes
+	(
+	const SJobLink *pjlFst,
+	const SJobLink *pjlSnd
+	)
+{
+	if (pjlFst->m_ullRound != pjlSnd->m_ullRound)
+	{
+		return pjlFst->m_ullRound > pjlSnd->m_ullRound;
+	}
+
+	const ULONG ulPriorityFst = pjlFst->m_pj->UlPriority();
+	const ULONG ulPrioritySnd = pjlSnd->m_pj->UlPriority();
+	if (ulPriorityFst != ulPrioritySnd)
+	{
+		return ulPriorityFst > ulPrioritySnd;
+	}
+
+	return pjlFst->m_ullSeq > pjlSnd->m_ullSeq;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::PushHeap
+//
+//	@doc:
+//		Add a job link to the heap of runnable jobs
+//
+//---------------------------------------------------------------------------
+void
+CScheduler::PushHeap
+	(
+	SJobLink *pjl
+	)
+{
+	GPOS_ASSERT(NULL != m_pjh);
+
+	CAutoSpinlock as(m_pjh->m_lock);
+	as.Lock();
+
+	// job link pool allocates extra links when exhausted, so the heap must grow as well
+	if (m_pjh->m_ulSize == m_pjh->m_ulCapacity)
+	{
+		SJobLink **rgpjlNew = GPOS_NEW_ARRAY(m_pjh->m_mp, SJobLink*, 2 * m_pjh->m_ulCapacity);
+		for (ULONG ul = 0; ul < m_pjh->m_ulSize; ul++)
+		{
+			rgpjlNew[ul] = m_pjh->m_rgpjl[ul];
+		}
+
+		GPOS_DELETE_ARRAY(m_pjh->m_rgpjl);
+		m_pjh->m_rgpjl = rgpjlNew;
+		m_pjh->m_ulCapacity *= 2;
+	}
+
+	pjl->m_ullRound = m_pjh->m_ullRound;
+	pjl->m_ullSeq = m_pjh->m_ullSeq++;
+
+	// sift up from the last position
+	SJobLink **rgpjl = m_pjh->m_rgpjl;
+	ULONG ulPos = m_pjh->m_ulSize++;
+	while (0 < ulPos)
+	{
+		const ULONG ulParent = (ulPos - 1) / 2;
+		if (!FPrecedes(pjl, rgpjl[ulParent]))
+		{
+			break;
+		}
+
+		rgpjl[ulPos] = rgpjl[ulParent];
+		ulPos = ulParent;
+	}
+	rgpjl[ulPos] = pjl;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::PjlPopHeap
+//
+//	@doc:
+//		Remove the job link with the highest priority from the heap of
+//		runnable jobs; returns NULL if the heap is empty
+//
+//---------------------------------------------------------------------------
+CScheduler::SJobLink *
+CScheduler::PjlPopHeap()
+{
+	GPOS_ASSERT(NULL != m_pjh);
+
+	CAutoSpinlock as(m_pjh->m_lock);
+	as.Lock();
+
+	if (0 == m_pjh->m_ulSize)
+	{
+		return NULL;
+	}
+
+	// jobs scheduled from now on run before the ones already in the heap
+	m_pjh->m_ullRound++;
+
+	SJobLink **rgpjl = m_pjh->m_rgpjl;
+	SJobLink *pjlTop = rgpjl[0];
+	SJobLink *pjlLast = rgpjl[--m_pjh->m_ulSize];
+	const ULONG ulSize = m_pjh->m_ulSize;
+
+	// sift the last job link down from the root
+	ULONG ulPos = 0;
+	while (true)
+	{
+		ULONG ulChild = 2 * ulPos + 1;
+		if (ulChild >= ulSize)
+		{
+			break;
+		}
+
+		if (ulChild + 1 < ulSize && FPrecedes(rgpjl[ulChild + 1], rgpjl[ulChild]))
+		{
+			ulChild++;
+		}
+
+		if (!FPrecedes(rgpjl[ulChild], pjlLast))
+		{
+			break;
+		}
+
+		rgpjl[ulPos] = rgpjl[ulChild];
+		ulPos = ulChild;
+	}
+
+	if (0 < ulSize)
+	{
+		rgpjl[ulPos] = pjlLast;
+	}
+
+	return pjlTop;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CScheduler::PjRetrieve
@@ -506,7 +1008,10 @@ CScheduler::EjrPostExecute
 //
 //---------------------------------------------------------------------------
 CJob *
-CScheduler::PjRetrieve()
+CScheduler::PjRetrieve
+	(
+	CSchedulerContext *psc
+	)
 {
 #ifdef GPOS_DEBUG
 	// restrict parallelism to keep track of jobs
@@ -517,8 +1022,31 @@ CScheduler::PjRetrieve()
 	}
 #endif // GPOS_DEBUG
 
+	SJobLink *pjl = NULL;
+
+	// retrieve the job with the highest priority
+	if (NULL != m_pjh)
+	{
+		pjl = PjlPopHeap();
+	}
+
+	// try the worker's own deque first, then other workers' deques
+	SJobDeque *pjd = PjdLocal(psc);
+	if (NULL != pjd)
+	{
+		pjl = PjlPop(pjd);
+		if (NULL == pjl)
+		{
+			pjl = PjlSteal(psc);
+		}
+	}
+
 	// retrieve runnable job from lists of waiting jobs
-	SJobLink *pjl = m_listjlWaiting.Pop();
+	if (NULL == pjl)
+	{
+		pjl = m_listjlWaiting.Pop();
+	}
+
 	CJob *pj = NULL;
 
 	if (NULL != pjl)
@@ -530,6 +1058,10 @@ CScheduler::PjRetrieve()
 
 		// decrement number of queued jobs
 		(void) ExchangeAddUlongPtrWithInt(&m_ulpQueued, -1);
+		if (FAdaptive())
+		{
+			(void) ExchangeAddUlongPtrWithInt(&m_rgulpQueued[pj->Ejt()], -1);
+		}
 
 		// update statistics
 		(void) ExchangeAddUlongPtrWithInt(&m_ulpStatsDequeued, 1);
@@ -598,7 +1130,8 @@ CScheduler::Suspend
 void
 CScheduler::Complete
 	(
-	CJob *pj
+	CJob *pj,
+	CSchedulerContext *psc
 	)
 {
 	GPOS_ASSERT(0 == pj->UlpRefs());
@@ -613,7 +1146,7 @@ CScheduler::Complete
 	}
 #endif // GPOS_DEBUG
 
-	ResumeParent(pj);
+	ResumeParent(pj, psc);
 
 	// update statistics
 	(void) ExchangeAddUlongPtrWithInt(&m_ulpTotal, -1);
@@ -632,7 +1165,8 @@ CScheduler::Complete
 void
 CScheduler::CompleteQueued
 	(
-	CJob *pj
+	CJob *pj,
+	CSchedulerContext *psc
 	)
 {
 	GPOS_ASSERT(0 == pj->UlpRefs());
@@ -651,7 +1185,7 @@ CScheduler::CompleteQueued
 	}
 #endif // GPOS_DEBUG
 
-	ResumeParent(pj);
+	ResumeParent(pj, psc);
 
 	// update statistics
 	(void) ExchangeAddUlongPtrWithInt(&m_ulpTotal, -1);
@@ -671,7 +1205,8 @@ CScheduler::CompleteQueued
 void
 CScheduler::ResumeParent
 	(
-	CJob *pj
+	CJob *pj,
+	CSchedulerContext *psc
 	)
 {
 	GPOS_ASSERT(0 == pj->UlpRefs());
@@ -692,7 +1227,7 @@ CScheduler::ResumeParent
 #endif // GPOS_DEBUG)
 
 			// reschedule parent
-			Resume(pjParent);
+			Resume(pjParent, psc);
 
 			// update statistics
 			(void) ExchangeAddUlongPtrWithInt(&m_ulpStatsResumed, 1);
@@ -715,14 +1250,32 @@ CScheduler::PrintStats() const
 	GPOS_TRACE_FORMAT
 		(
 		"Job statistics: Queued=%d Dequeued=%d Suspended=%d "
-		                "Resumed=%d CompletedQueued=%d Completed=%d",
+		                "Resumed=%d CompletedQueued=%d Completed=%d Stolen=%d "
+		                "Wakeups=%d Retired=%d",
 		m_ulpStatsQueued,
 		m_ulpStatsDequeued,
 		m_ulpStatsSuspended,
 		m_ulpStatsResumed,
 		m_ulpStatsCompletedQueued,
-		m_ulpStatsCompleted
+		m_ulpStatsCompleted,
+		m_ulpStatsStolen,
+		m_ulpStatsWakeups,
+		m_ulpStatsRetired
 		);
+
+	for (ULONG ul = 0; FAdaptive() && ul < CJob::EjtSentinel; ul++)
+	{
+		if (0 < m_rgulpStatsExecuted[ul])
+		{
+			GPOS_TRACE_FORMAT
+				(
+				"Job type %d: Executed=%d AvgTime=%dus",
+				ul,
+				m_rgulpStatsExecuted[ul],
+				(ULONG) UllAvgExecTimeUS((CJob::EJobType) ul)
+				);
+		}
+	}
 }
 
 
@@ -764,6 +1317,30 @@ CScheduler::OsPrintActiveJobs
 		pjl = m_listjlWaiting.Next(pjl);
 	}
 
+	if (NULL != m_pjh)
+	{
+		CAutoSpinlock as(m_pjh->m_lock);
+		as.Lock();
+
+		for (ULONG ul = 0; ul < m_pjh->m_ulSize; ul++)
+		{
+			m_pjh->m_rgpjl[ul]->m_pj->OsPrint(os);
+		}
+	}
+
+	for (ULONG_PTR ulp = 0; NULL != m_rgjd && ulp < m_ulpTasksMax; ulp++)
+	{
+		CAutoSpinlock as(m_rgjd[ulp].m_lock);
+		as.Lock();
+
+		pjl = m_rgjd[ulp].m_listjl.First();
+		while(NULL != pjl)
+		{
+			pjl->m_pj->OsPrint(os);
+			pjl = m_rgjd[ulp].m_listjl.Next(pjl);
+		}
+	}
+
 	os << std::endl << "List of suspended jobs: " << std::endl;
 	pj = m_listjSuspended.First();
 	while(NULL != pj)
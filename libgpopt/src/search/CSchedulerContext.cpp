@@ -34,6 +34,7 @@ CSchedulerContext::CSchedulerContext()
 	m_pmpGlobal(NULL),
 	m_pmpLocal(NULL),
 	m_psched(NULL),
+	m_ulWorkerId(0),
 	m_fInit(false)
 {}
 
@@ -74,7 +75,8 @@ CSchedulerContext::Init
 	IMemoryPool *pmpGlobal,
 	CJobFactory *pjf,
 	CScheduler *psched,
-	CEngine *peng
+	CEngine *peng,
+	ULONG ulWorkerId
 	)
 {
 	GPOS_ASSERT(NULL != pmpGlobal);
@@ -95,6 +97,7 @@ CSchedulerContext::Init
 	m_pjf = pjf;
 	m_psched = psched;
 	m_peng= peng;
+	m_ulWorkerId = ulWorkerId;
 	m_fInit = true;
 }
 
@@ -16,12 +16,14 @@
 
 #include "gpos/common/clibwrapper.h"
 #include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
 
 #include "gpopt/base/CDrvdPropScalar.h"
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/operators/ops.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/xforms/CJoinOrder.h"
+#include "gpopt/xforms/CJoinStatsCache.h"
 
 
 using namespace gpopt;
@@ -67,6 +69,7 @@ CJoinOrder::SComponent::SComponent
 	)
 	:
 	m_pbs(NULL),
+	m_ullCover(0),
 	m_edge_set(NULL),
 	m_pexpr(pexpr),
 	m_fUsed(false),
@@ -89,6 +92,7 @@ CJoinOrder::SComponent::SComponent
 	)
 	:
 	m_pbs(pbs),
+	m_ullCover(0),
 	m_edge_set(edge_set),
 	m_pexpr(pexpr),
 	m_fUsed(false),
@@ -169,6 +173,7 @@ CJoinOrder::SEdge::SEdge
 	)
 	:
 	m_pbs(NULL),
+	m_ullCover(0),
 	m_pexpr(pexpr),
 	m_is_loj(is_loj),
 	m_fUsed(false)
@@ -236,7 +241,9 @@ CJoinOrder::CJoinOrder
 	m_ulEdges(0),
 	m_rgpcomp(NULL),
 	m_ulComps(0),
-	m_include_loj_childs(include_loj_childs)
+	m_include_loj_childs(include_loj_childs),
+	m_fCoverMasks(false),
+	m_pjsc(NULL)
 {
 	typedef SComponent* Pcomp;
 	typedef SEdge* Pedge;
@@ -334,6 +341,21 @@ CJoinOrder::CJoinOrder
 
 	ComputeEdgeCover();
 
+	// keep covers as bit masks if all components fit into one
+	m_fCoverMasks = (GPOPT_JOIN_ORDER_MASK_COMPONENTS >= m_ulComps);
+	if (m_fCoverMasks)
+	{
+		for (ULONG ul = 0; ul < m_ulComps; ul++)
+		{
+			m_rgpcomp[ul]->m_ullCover = UllMask(m_rgpcomp[ul]->m_pbs);
+		}
+
+		for (ULONG ul = 0; ul < m_ulEdges; ul++)
+		{
+			m_rgpedge[ul]->m_ullCover = UllMask(m_rgpedge[ul]->m_pbs);
+		}
+	}
+
 	all_components->Release();
 	inner_join_conjuncts->Release();
 }
@@ -360,6 +382,8 @@ CJoinOrder::~CJoinOrder()
 		m_rgpedge[ul]->Release();
 	}
 	GPOS_DELETE_ARRAY(m_rgpedge);
+
+	CRefCount::SafeRelease(m_pjsc);
 }
 
 
@@ -416,6 +440,7 @@ CJoinOrder::PcompCombine
 
 	pbs->Union(comp1->m_pbs);
 	pbs->Union(comp2->m_pbs);
+	ULLONG ullCover = comp1->m_ullCover | comp2->m_ullCover;
 
 	// edges connecting with the current component
 	edge_set->Union(comp1->m_edge_set);
@@ -435,7 +460,7 @@ CJoinOrder::PcompCombine
 			continue;
 		}
 
-		if (pbs->ContainsAll(pedge->m_pbs))
+		if (FCovers(pbs, ullCover, pedge))
 		{
 			// edge is subsumed by the cover of the combined component
 			CExpression *pexpr = pedge->m_pexpr;
@@ -533,11 +558,96 @@ CJoinOrder::PcompCombine
 	// of loj id indicated by parent_loj_id
 	GPOS_ASSERT_IMP(NON_LOJ_DEFAULT_ID < parent_loj_id, EpLeft == position);
 	SComponent *join_comp = GPOS_NEW(m_mp) SComponent(pexpr, pbs, edge_set, parent_loj_id, position);
+	join_comp->m_ullCover = ullCover;
 
 	return join_comp;
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrder::UllMask
+//
+//	@doc:
+//		Bit mask of the components in the given set
+//
+//---------------------------------------------------------------------------
+ULLONG
+CJoinOrder::UllMask
+	(
+	const CBitSet *pbs
+	)
+{
+	ULLONG ull = 0;
+	CBitSetIter bsi(*pbs);
+	while (bsi.Advance())
+	{
+		ull |= UllComponent(bsi.Bit());
+	}
+
+	return ull;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrder::UlComponents
+//
+//	@doc:
+//		Number of components in the given bit mask
+//
+//---------------------------------------------------------------------------
+ULONG
+CJoinOrder::UlComponents
+	(
+	ULLONG ull
+	)
+{
+	ULONG ulComps = 0;
+	while (0 != ull)
+	{
+		// clear lowest set bit
+		ull &= ull - 1;
+		ulComps++;
+	}
+
+	return ulComps;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrder::UlFirstComponent
+//
+//	@doc:
+//		First component in the given non-empty bit mask
+//
+//---------------------------------------------------------------------------
+ULONG
+CJoinOrder::UlFirstComponent
+	(
+	ULLONG ull
+	)
+{
+	GPOS_ASSERT(0 != ull);
+
+	ULONG ulComp = 0;
+	while (0 == (ull & ((ULLONG) 0xFFFFFFFF)))
+	{
+		ull >>= 32;
+		ulComp += 32;
+	}
+
+	while (0 == (ull & 1))
+	{
+		ull >>= 1;
+		ulComp++;
+	}
+
+	return ulComp;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrder::DeriveStats
@@ -566,6 +676,75 @@ CJoinOrder::DeriveStats
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrder::DeriveCoverStats
+//
+//	@doc:
+//		Derive stats on a join of the components in the given cover, reusing
+//		the stats of an identical join from the join stats cache if any
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrder::DeriveCoverStats
+	(
+	CExpression *pexpr,
+	ULLONG ullCover
+	)
+{
+	GPOS_ASSERT(NULL != pexpr);
+
+	if (NULL != pexpr->Pstats())
+	{
+		// stats have been already derived
+		return;
+	}
+
+	if (NULL == m_pjsc || !m_fCoverMasks)
+	{
+		DeriveStats(pexpr);
+		return;
+	}
+
+	IStatistics *stats = m_pjsc->PstatsLookup(ullCover, pexpr);
+	if (NULL != stats)
+	{
+		pexpr->AttachStats(stats);
+		stats->Release();
+		return;
+	}
+
+	DeriveStats(pexpr);
+	if (NULL != pexpr->Pstats())
+	{
+		m_pjsc->Insert(ullCover, pexpr);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrder::SetStatsCache
+//
+//	@doc:
+//		Share the stats of the joins built with other join orders of the
+//		same n-ary join
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrder::SetStatsCache
+	(
+	CJoinStatsCache *pjsc
+	)
+{
+	GPOS_ASSERT(NULL != pjsc);
+
+	pjsc->AddRef();
+	CRefCount::SafeRelease(m_pjsc);
+	m_pjsc = pjsc;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrder::OsPrint
@@ -723,7 +902,7 @@ CJoinOrder::MarkUsedEdges
 			continue;
 		}
 
-		if (pcomponent->m_pbs->ContainsAll(pedge->m_pbs))
+		if (FCovers(pcomponent->m_pbs, pcomponent->m_ullCover, pedge))
 		{
 			pedge->m_fUsed = true;
 		}
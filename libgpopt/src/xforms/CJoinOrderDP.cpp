@@ -14,12 +14,15 @@
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 
+#include "gpos/common/CAutoRg.h"
 #include "gpos/common/clibwrapper.h"
-#include "gpos/common/CBitSet.h"
-#include "gpos/common/CBitSetIter.h"
+#include "gpos/task/CAutoTaskProxy.h"
 
 #include "gpopt/base/CDrvdPropScalar.h"
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CUtils.h"
+#include "gpopt/engine/CSchedulerConfig.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/operators/ops.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CNormalizer.h"
@@ -31,90 +34,14 @@ using namespace gpopt;
 
 #define GPOPT_DP_JOIN_ORDERING_TOPK	10
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CJoinOrderDP::SComponentPair::SComponentPair
-//
-//	@doc:
-//		Ctor
-//
-//---------------------------------------------------------------------------
-CJoinOrderDP::SComponentPair::SComponentPair
-	(
-	CBitSet *pbsFst,
-	CBitSet *pbsSnd
-	)
-	:
-	m_pbsFst(pbsFst),
-	m_pbsSnd(pbsSnd)
-{
-	GPOS_ASSERT(NULL != pbsFst);
-	GPOS_ASSERT(NULL != pbsSnd);
-	GPOS_ASSERT(pbsFst->IsDisjoint(pbsSnd));
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CJoinOrderDP::SComponentPair::HashValue
-//
-//	@doc:
-//		Hash function
-//
-//---------------------------------------------------------------------------
-ULONG
-CJoinOrderDP::SComponentPair::HashValue
-	(
-	const SComponentPair *pcomppair
-	)
-{
-	GPOS_ASSERT(NULL != pcomppair);
-
-	return CombineHashes
-			(
-			pcomppair->m_pbsFst->HashValue(),
-			pcomppair->m_pbsSnd->HashValue()
-			);
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CJoinOrderDP::SComponentPair::Equals
-//
-//	@doc:
-//		Equality function
-//
-//---------------------------------------------------------------------------
-BOOL
-CJoinOrderDP::SComponentPair::Equals
-	(
-	const SComponentPair *pcomppairFst,
-	const SComponentPair *pcomppairSnd
-	)
-{
-	GPOS_ASSERT(NULL != pcomppairFst);
-	GPOS_ASSERT(NULL != pcomppairSnd);
+// maximum number of components of a set for which all splits of the set are tried
+#define GPOPT_DP_JOIN_ORDERING_SPLIT_LIMIT	10
 
-	return pcomppairFst->m_pbsFst->Equals(pcomppairSnd->m_pbsFst) &&
-		pcomppairFst->m_pbsSnd->Equals(pcomppairSnd->m_pbsSnd);
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CJoinOrderDP::SComponentPair::~SComponentPair
-//
-//	@doc:
-//		Dtor
-//
-//---------------------------------------------------------------------------
-CJoinOrderDP::SComponentPair::~SComponentPair()
-{
-	m_pbsFst->Release();
-	m_pbsSnd->Release();
-}
+// initial number of entries of the DP and link tables
+#define GPOPT_DP_JOIN_ORDERING_TABLE_SLOTS	256
 
+// initial number of connected subset / connected complement pairs
+#define GPOPT_DP_JOIN_ORDERING_PAIR_SLOTS	256
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -133,11 +60,60 @@ CJoinOrderDP::CJoinOrderDP
 	:
 	CJoinOrder(mp, pdrgpexprComponents, pdrgpexprConjuncts, false /* m_include_loj_childs */)
 {
-	m_phmcomplink = GPOS_NEW(mp) ComponentPairToExpressionMap(mp);
-	m_phmbsexpr = GPOS_NEW(mp) BitSetToExpressionMap(mp);
+	if (!m_fCoverMasks)
+	{
+		GPOS_RAISE(CException::ExmaInvalid, CException::ExmiInvalid, GPOS_WSZ_LIT("Too many components for dynamic programming join ordering"));
+	}
+
+	m_pjotLinks = GPOS_NEW(mp) CJoinOrderTable(mp, GPOPT_DP_JOIN_ORDERING_TABLE_SLOTS);
+	m_pjotBest = GPOS_NEW(mp) CJoinOrderTable(mp, GPOPT_DP_JOIN_ORDERING_TABLE_SLOTS);
 	m_phmexprcost = GPOS_NEW(mp) ExpressionToCostMap(mp);
 	m_pdrgpexprTopKOrders = GPOS_NEW(mp) CExpressionArray(mp);
 	m_pexprDummy = GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp));
+	m_ullEnumerated = 0;
+	m_ulCsgCmpPairs = 0;
+	m_rgcsgcmp = NULL;
+	m_ulPairs = 0;
+	m_ulPairSlots = 0;
+
+	// components are neighbors if they share an edge
+	m_rgullNeighbors = GPOS_NEW_ARRAY(mp, ULLONG, m_ulComps);
+	for (ULONG ul = 0; ul < m_ulComps; ul++)
+	{
+		m_rgullNeighbors[ul] = 0;
+	}
+
+	for (ULONG ulEdge = 0; ulEdge < m_ulEdges; ulEdge++)
+	{
+		ULLONG ullEdge = m_rgpedge[ulEdge]->m_ullCover;
+		for (ULLONG ull = ullEdge; 0 != ull; ull &= ull - 1)
+		{
+			m_rgullNeighbors[UlFirstComponent(ull)] |= ullEdge;
+		}
+	}
+
+	for (ULONG ul = 0; ul < m_ulComps; ul++)
+	{
+		m_rgullNeighbors[ul] &= ~UllComponent(ul);
+	}
+
+	// stats of join orders over connected subsets are derived for the
+	// columns of all join predicates, so joining them never needs to
+	// derive more stats on their children
+	CColRefSet *pcrsJoin = GPOS_NEW(mp) CColRefSet(mp);
+	for (ULONG ulEdge = 0; ulEdge < m_ulEdges; ulEdge++)
+	{
+		CExpression *pexprPred = m_rgpedge[ulEdge]->m_pexpr;
+		pcrsJoin->Include(CDrvdPropScalar::GetDrvdScalarProps(pexprPred->PdpDerive())->PcrsUsed());
+	}
+	m_prprelJoin = GPOS_NEW(mp) CReqdPropRelational(pcrsJoin);
+
+	// stats are derived by the optimizer's workers when optimizing in parallel
+	m_ulWorkers = 1;
+	if (GPOS_FTRACE(EopttraceParallel))
+	{
+		m_ulWorkers = COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetSchedulerConf()->UlWorkers();
+	}
 
 #ifdef GPOS_DEBUG
 	for (ULONG ul = 0; ul < m_ulComps; ul++)
@@ -163,11 +139,14 @@ CJoinOrderDP::~CJoinOrderDP()
 	// in optimized build, we flush-down memory pools without leak checking,
 	// we can save time in optimized build by skipping all de-allocations here,
 	// we still have all de-llocations enabled in debug-build to detect any possible leaks
-	m_phmcomplink->Release();
-	m_phmbsexpr->Release();
+	GPOS_DELETE(m_pjotLinks);
+	GPOS_DELETE(m_pjotBest);
 	m_phmexprcost->Release();
 	m_pdrgpexprTopKOrders->Release();
 	m_pexprDummy->Release();
+	GPOS_DELETE_ARRAY(m_rgullNeighbors);
+	GPOS_DELETE_ARRAY(m_rgcsgcmp);
+	m_prprelJoin->Release();
 #endif // GPOS_DEBUG
 }
 
@@ -236,6 +215,7 @@ CJoinOrderDP::AddJoinOrder
 }
 
 
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrderDP::PexprLookup
@@ -247,20 +227,46 @@ CJoinOrderDP::AddJoinOrder
 CExpression *
 CJoinOrderDP::PexprLookup
 	(
-	CBitSet *pbs
+	ULLONG ull
 	)
 {
 	// if set has size 1, return expression directly
-	if (1 == pbs->Size())
+	if (1 == UlComponents(ull))
 	{
-		CBitSetIter bsi(*pbs);
-		(void) bsi.Advance();
-
-		return m_rgpcomp[bsi.Bit()]->m_pexpr;
+		return m_rgpcomp[UlFirstComponent(ull)]->m_pexpr;
 	}
 
 	// otherwise, return expression by looking up DP table
-	return m_phmbsexpr->Find(pbs);
+	CJoinOrderTable::SEntry *pentry = m_pjotBest->PentryFind(ull);
+	if (NULL == pentry)
+	{
+		return NULL;
+	}
+
+	return pentry->m_pexpr;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::InsertBest
+//
+//	@doc:
+//		Store join order of given set in DP table; the table takes over the
+//		reference to the given expression
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDP::InsertBest
+	(
+	ULLONG ull,
+	CExpression *pexpr
+	)
+{
+	CJoinOrderTable::SEntry *pentry = m_pjotBest->PentryInsert(ull);
+	GPOS_ASSERT(NULL == pentry->m_pexpr);
+
+	CJoinOrderTable::SetExpression(pentry, pexpr);
 }
 
 
@@ -275,68 +281,44 @@ CJoinOrderDP::PexprLookup
 CExpression *
 CJoinOrderDP::PexprPred
 	(
-	CBitSet *pbsFst,
-	CBitSet *pbsSnd
+	ULLONG ullFst,
+	ULLONG ullSnd
 	)
 {
-	GPOS_ASSERT(NULL != pbsFst);
-	GPOS_ASSERT(NULL != pbsSnd);
-
-	if (!pbsFst->IsDisjoint(pbsSnd) || 0 == pbsFst->Size() || 0 == pbsSnd->Size())
+	if (0 != (ullFst & ullSnd) || 0 == ullFst || 0 == ullSnd)
 	{
 		// components must be non-empty and disjoint
 		return NULL;
 	}
 
-	CExpression *pexprPred = NULL;
-	SComponentPair *pcomppair = NULL;
+	// links do not depend on the order of the sets
+	if (ullSnd < ullFst)
+	{
+		std::swap(ullFst, ullSnd);
+	}
 
 	// lookup link map
-	for (ULONG ul = 0; ul < 2; ul++)
+	CJoinOrderTable::SEntry *pentry = m_pjotLinks->PentryInsert(ullFst, ullSnd);
+	if (NULL == pentry->m_pexpr)
 	{
-		pbsFst->AddRef();
-		pbsSnd->AddRef();
-		pcomppair = GPOS_NEW(m_mp) SComponentPair(pbsFst, pbsSnd);
-		pexprPred = m_phmcomplink->Find(pcomppair);
-		if (NULL != pexprPred)
+		// could not find link in the map, construct it from edge set
+		CExpression *pexprPred = PexprBuildPred(ullFst, ullSnd);
+		if (NULL == pexprPred)
 		{
-			pcomppair->Release();
-			if (m_pexprDummy == pexprPred)
-			{
-				return NULL;
-			}
-			return pexprPred;
+			m_pexprDummy->AddRef();
+			pexprPred = m_pexprDummy;
 		}
 
-		// try again after swapping sets
-		if (0 == ul)
-		{
-			pcomppair->Release();
-			std::swap(pbsFst, pbsSnd);
-		}
+		// store predicate in link map
+		CJoinOrderTable::SetExpression(pentry, pexprPred);
 	}
 
-	// could not find link in the map, construct it from edge set
-	pexprPred = PexprBuildPred(pbsFst, pbsSnd);
-	if (NULL == pexprPred)
-	{
-		m_pexprDummy->AddRef();
-		pexprPred = m_pexprDummy;
-	}
-
-	// store predicate in link map
-#ifdef GPOS_DEBUG
-	BOOL fInserted =
-#endif // GPOS_DEBUG
-		m_phmcomplink->Insert(pcomppair, pexprPred);
-	GPOS_ASSERT(fInserted);
-
-	if (m_pexprDummy != pexprPred)
+	if (m_pexprDummy == pentry->m_pexpr)
 	{
-		return pexprPred;
+		return NULL;
 	}
 
-	return NULL;
+	return pentry->m_pexpr;
 }
 
 
@@ -351,20 +333,17 @@ CJoinOrderDP::PexprPred
 CExpression *
 CJoinOrderDP::PexprJoin
 	(
-	CBitSet *pbsFst,
-	CBitSet *pbsSnd
+	ULLONG ullFst,
+	ULLONG ullSnd
 	)
 {
-	GPOS_ASSERT(NULL != pbsFst);
-	GPOS_ASSERT(NULL != pbsSnd);
-
-	CExpression *pexprFst = PexprLookup(pbsFst);
+	CExpression *pexprFst = PexprLookup(ullFst);
 	GPOS_ASSERT(NULL != pexprFst);
 
-	CExpression *pexprSnd = PexprLookup(pbsSnd);
+	CExpression *pexprSnd = PexprLookup(ullSnd);
 	GPOS_ASSERT(NULL != pexprSnd);
 
-	CExpression *pexprScalar = PexprPred(pbsFst, pbsSnd);
+	CExpression *pexprScalar = PexprPred(ullFst, ullSnd);
 	GPOS_ASSERT(NULL != pexprScalar);
 
 	pexprFst->AddRef();
@@ -399,6 +378,8 @@ CJoinOrderDP::DeriveStats
 	}
 }
 
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrderDP::InsertExpressionCost
@@ -438,6 +419,7 @@ CJoinOrderDP::InsertExpressionCost
 }
 
 
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrderDP::PexprJoin
@@ -449,26 +431,15 @@ CJoinOrderDP::InsertExpressionCost
 CExpression *
 CJoinOrderDP::PexprJoin
 	(
-	CBitSet *pbs
+	ULLONG ull
 	)
 {
-	GPOS_ASSERT(2 == pbs->Size());
-
-	CBitSetIter bsi(*pbs);
-	(void) bsi.Advance();
-	ULONG ulCompFst = bsi.Bit();
-	(void) bsi.Advance();
-	ULONG ulCompSnd = bsi.Bit();
-	GPOS_ASSERT(!bsi.Advance());
-
-	CBitSet *pbsFst = GPOS_NEW(m_mp) CBitSet(m_mp);
-	(void) pbsFst->ExchangeSet(ulCompFst);
-	CBitSet *pbsSnd = GPOS_NEW(m_mp) CBitSet(m_mp);
-	(void) pbsSnd->ExchangeSet(ulCompSnd);
-	CExpression *pexprScalar = PexprPred(pbsFst, pbsSnd);
-	pbsFst->Release();
-	pbsSnd->Release();
+	GPOS_ASSERT(2 == UlComponents(ull));
+
+	const ULONG ulCompFst = UlFirstComponent(ull);
+	const ULONG ulCompSnd = UlFirstComponent(ull & (ull - 1));
 
+	CExpression *pexprScalar = PexprPred(UllComponent(ulCompFst), UllComponent(ulCompSnd));
 	if (NULL == pexprScalar)
 	{
 		return NULL;
@@ -482,14 +453,10 @@ CJoinOrderDP::PexprJoin
 	CExpression *pexprJoin =
 		CUtils::PexprLogicalJoin<CLogicalInnerJoin>(m_mp, pexprLeft, pexprRight, pexprScalar);
 
-	DeriveStats(pexprJoin);
+	DeriveCoverStats(pexprJoin, ull);
 	// store solution in DP table
-	pbs->AddRef();
-#ifdef GPOS_DEBUG
-	BOOL fInserted =
-#endif // GPOS_DEBUG
-		m_phmbsexpr->Insert(pbs, pexprJoin);
-	GPOS_ASSERT(fInserted);
+	pexprJoin->AddRef();
+	InsertBest(ull, pexprJoin);
 
 	return pexprJoin;
 }
@@ -497,11 +464,11 @@ CJoinOrderDP::PexprJoin
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CJoinOrderDP::PexprBestJoinOrderDP
+//		CJoinOrderDP::PexprBestJoinOrderSplits
 //
 //	@doc:
-//		Find the best join order of a given set of elements using dynamic
-//		programming;
+//		Find the best join order of a given set of elements that cannot be
+//		joined without cross products;
 //		given a set of elements (e.g., {A, B, C}), we find all possible splits
 //		of the set (e.g., {A}, {B, C}) where at least one edge connects the
 //		two subsets resulting from the split,
@@ -513,35 +480,52 @@ CJoinOrderDP::PexprJoin
 //
 //---------------------------------------------------------------------------
 CExpression *
-CJoinOrderDP::PexprBestJoinOrderDP
+CJoinOrderDP::PexprBestJoinOrderSplits
 	(
-	CBitSet *pbs // set of elements to be joined
+	ULLONG ull // set of elements to be joined
 	)
 {
 	CDouble dMinCost(0.0);
 	CExpression *pexprResult = NULL;
 
-	CBitSetArray *pdrgpbsSubsets = PdrgpbsSubsets(m_mp, pbs);
-	const ULONG ulSubsets = pdrgpbsSubsets->Size();
-	for (ULONG ul = 0; ul < ulSubsets; ul++)
+	ULONG rgulElems[GPOPT_JOIN_ORDER_MASK_COMPONENTS];
+	ULONG size = 0;
+	for (ULLONG ullRest = ull; 0 != ullRest; ullRest &= ullRest - 1)
+	{
+		rgulElems[size++] = UlFirstComponent(ullRest);
+	}
+	GPOS_ASSERT(GPOPT_DP_JOIN_ORDERING_SPLIT_LIMIT >= size);
+
+	// splits are tried in the order of a recursion including each element
+	// before excluding it, counting down with the first element as the
+	// most significant bit; the empty set and the set itself are skipped
+	// as they split nothing
+	const ULONG ulSplits = (ULONG(1) << size) - 1;
+	for (ULONG ulSplit = ulSplits - 1; 0 < ulSplit; ulSplit--)
 	{
-		CBitSet *pbsCurrent = (*pdrgpbsSubsets)[ul];
-		CBitSet *pbsRemaining = GPOS_NEW(m_mp) CBitSet(m_mp, *pbs);
-		pbsRemaining->Difference(pbsCurrent);
+		ULLONG ullCurrent = 0;
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			if (0 != (ulSplit & (ULONG(1) << (size - 1 - ul))))
+			{
+				ullCurrent |= UllComponent(rgulElems[ul]);
+			}
+		}
+		ULLONG ullRemaining = ull & ~ullCurrent;
 
 		// check if subsets are connected with one or more edges
-		CExpression *pexprPred = PexprPred(pbsCurrent, pbsRemaining);
+		CExpression *pexprPred = PexprPred(ullCurrent, ullRemaining);
 		if (NULL != pexprPred)
 		{
 			// compute solutions of left and right subsets recursively
-			CExpression *pexprLeft = PexprBestJoinOrder(pbsCurrent);
-			CExpression *pexprRight = PexprBestJoinOrder(pbsRemaining);
+			CExpression *pexprLeft = PexprBestJoinOrder(ullCurrent);
+			CExpression *pexprRight = PexprBestJoinOrder(ullRemaining);
 
 			if (NULL != pexprLeft && NULL != pexprRight)
 			{
 				// we found solutions of left and right subsets, we check if
 				// this gives a better solution for the input set
-				CExpression *pexprJoin = PexprJoin(pbsCurrent, pbsRemaining);
+				CExpression *pexprJoin = PexprJoin(ullCurrent, ullRemaining);
 				CDouble dCost = DCost(pexprJoin);
 
 				if (NULL == pexprResult || dCost < dMinCost)
@@ -553,7 +537,7 @@ CJoinOrderDP::PexprBestJoinOrderDP
 					pexprResult = pexprJoin;
 				}
 
-				if (m_ulComps == pbs->Size())
+				if (m_ulComps == size)
 				{
 					AddJoinOrder(pexprJoin, dCost);
 				}
@@ -561,9 +545,7 @@ CJoinOrderDP::PexprBestJoinOrderDP
 				pexprJoin->Release();
 			}
 		}
-		pbsRemaining->Release();
 	}
-	pdrgpbsSubsets->Release();
 
 	// store solution in DP table
 	if (NULL == pexprResult)
@@ -571,14 +553,21 @@ CJoinOrderDP::PexprBestJoinOrderDP
 		m_pexprDummy->AddRef();
 		pexprResult = m_pexprDummy;
 	}
+	else
+	{
+		DeriveCoverStats(pexprResult, ull);
+	}
 
-	DeriveStats(pexprResult);
-	pbs->AddRef();
-#ifdef GPOS_DEBUG
-	BOOL fInserted =
-#endif // GPOS_DEBUG
-		m_phmbsexpr->Insert(pbs, pexprResult);
-	GPOS_ASSERT(fInserted);
+	CJoinOrderTable::SEntry *pentry = m_pjotBest->PentryInsert(ull);
+	GPOS_ASSERT(NULL == pentry->m_pexpr);
+	if (m_pexprDummy == pexprResult)
+	{
+		CJoinOrderTable::SetExpression(pentry, pexprResult);
+	}
+	else
+	{
+		CJoinOrderTable::SetExpression(pentry, pexprResult, dMinCost);
+	}
 
 	// add expression cost to cost map
 	InsertExpressionCost(pexprResult, dMinCost, false /*fValidateInsert*/);
@@ -589,80 +578,647 @@ CJoinOrderDP::PexprBestJoinOrderDP
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CJoinOrderDP::GenerateSubsets
+//		CJoinOrderDP::UllNeighborhood
+//
+//	@doc:
+//		Return the components of the given set that share an edge with the
+//		given subset, excluding the subset and the given excluded components
+//
+//---------------------------------------------------------------------------
+ULLONG
+CJoinOrderDP::UllNeighborhood
+	(
+	ULLONG ull,
+	ULLONG ullSubset,
+	ULLONG ullExcluded
+	)
+	const
+{
+	ULLONG ullNeighborhood = 0;
+	for (ULLONG ullRest = ullSubset; 0 != ullRest; ullRest &= ullRest - 1)
+	{
+		ullNeighborhood |= m_rgullNeighbors[UlFirstComponent(ullRest)];
+	}
+
+	return ullNeighborhood & ull & ~ullSubset & ~ullExcluded;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::EnumerateCsgCmpPairs
 //
 //	@doc:
-//		Generate all subsets of given array of elements
+//		Solve all connected subsets of the given set by enumerating each pair
+//		of a connected subset and a connected complement joined by an edge
+//		exactly once (DPccp, Moerkotte and Neumann, VLDB 2006);
+//		edges spanning more than two components are treated as connecting
+//		all their components, and pairs are only joined if an edge is fully
+//		covered by them
 //
 //---------------------------------------------------------------------------
 void
-CJoinOrderDP::GenerateSubsets
+CJoinOrderDP::EnumerateCsgCmpPairs
 	(
-	IMemoryPool *mp,
-	CBitSet *pbsCurrent,
-	ULONG *pulElems,
-	ULONG size,
-	ULONG ulIndex,
-	CBitSetArray *pdrgpbsSubsets
+	ULLONG ull
+	)
+{
+	m_ulPairs = 0;
+
+	ULONG rgulElems[GPOPT_JOIN_ORDER_MASK_COMPONENTS];
+	ULONG size = 0;
+	for (ULLONG ullRest = ull; 0 != ullRest; ullRest &= ullRest - 1)
+	{
+		rgulElems[size++] = UlFirstComponent(ullRest);
+	}
+
+	// grow connected subsets from each component in descending order,
+	// never adding components before it
+	for (ULONG ul = size; ul > 0; ul--)
+	{
+		ULLONG ullCsg = UllComponent(rgulElems[ul - 1]);
+		ULLONG ullExcluded = ull & ((ullCsg << 1) - 1);
+
+		EmitCsg(ull, ullCsg);
+		EnumerateCsgRec(ull, ullCsg, ullExcluded);
+	}
+
+	SolveCsgCmpPairs(ull);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::EnumerateCsgRec
+//
+//	@doc:
+//		Enumerate the connected subsets extending the given connected subset
+//		by neighbors that are not excluded; subsets of the neighborhood are
+//		visited in increasing order of their masks, so each comes after its
+//		own subsets
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDP::EnumerateCsgRec
+	(
+	ULLONG ull,
+	ULLONG ullCsg,
+	ULLONG ullExcluded
 	)
 {
 	GPOS_CHECK_STACK_SIZE;
 	GPOS_CHECK_ABORT;
 
-	GPOS_ASSERT(ulIndex <= size);
-	GPOS_ASSERT(NULL != pbsCurrent);
-	GPOS_ASSERT(NULL != pulElems);
-	GPOS_ASSERT(NULL != pdrgpbsSubsets);
+	const ULLONG ullNeighborhood = UllNeighborhood(ull, ullCsg, ullExcluded);
+	if (0 == ullNeighborhood)
+	{
+		return;
+	}
+
+	ULLONG ullSubset = 0;
+	do
+	{
+		ullSubset = (ullSubset - ullNeighborhood) & ullNeighborhood;
+		EmitCsg(ull, ullCsg | ullSubset);
+	}
+	while (ullSubset != ullNeighborhood);
+
+	// neighbors not added now are not added later either
+	const ULLONG ullExcludedRec = ullExcluded | ullNeighborhood;
+	ullSubset = 0;
+	do
+	{
+		ullSubset = (ullSubset - ullNeighborhood) & ullNeighborhood;
+		EnumerateCsgRec(ull, ullCsg | ullSubset, ullExcludedRec);
+	}
+	while (ullSubset != ullNeighborhood);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::EmitCsg
+//
+//	@doc:
+//		Enumerate the connected complements of the given connected subset;
+//		complements only contain components after the first component of
+//		the subset, so each pair is enumerated once
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDP::EmitCsg
+	(
+	ULLONG ull,
+	ULLONG ullCsg
+	)
+{
+	const ULLONG ullFirst = ullCsg & (0 - ullCsg);
+	const ULLONG ullExcluded = (ull & ((ullFirst << 1) - 1)) | ullCsg;
+	const ULLONG ullNeighborhood = UllNeighborhood(ull, ullCsg, ullExcluded);
 
-	if (ulIndex == size)
+	ULONG rgulElems[GPOPT_JOIN_ORDER_MASK_COMPONENTS];
+	ULONG size = 0;
+	for (ULLONG ullRest = ullNeighborhood; 0 != ullRest; ullRest &= ullRest - 1)
+	{
+		rgulElems[size++] = UlFirstComponent(ullRest);
+	}
+
+	// grow complements from each neighbor in descending order, never
+	// adding neighbors before it
+	for (ULONG ul = size; ul > 0; ul--)
+	{
+		ULLONG ullCmp = UllComponent(rgulElems[ul - 1]);
+		EmitCsgCmp(ullCsg, ullCmp);
+
+		ULLONG ullExcludedCmp = ullExcluded | (ullNeighborhood & ((ullCmp << 1) - 1));
+		EnumerateCmpRec(ull, ullCsg, ullCmp, ullExcludedCmp);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::EnumerateCmpRec
+//
+//	@doc:
+//		Enumerate the connected complements extending the given connected
+//		complement by neighbors that are not excluded
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDP::EnumerateCmpRec
+	(
+	ULLONG ull,
+	ULLONG ullCsg,
+	ULLONG ullCmp,
+	ULLONG ullExcluded
+	)
+{
+	GPOS_CHECK_STACK_SIZE;
+	GPOS_CHECK_ABORT;
+
+	const ULLONG ullNeighborhood = UllNeighborhood(ull, ullCmp, ullExcluded);
+	if (0 == ullNeighborhood)
 	{
-		pdrgpbsSubsets->Append(pbsCurrent);
 		return;
 	}
 
-	CBitSet *pbsCopy = GPOS_NEW(mp) CBitSet(mp, *pbsCurrent);
-#ifdef GPOS_DEBUG
-	BOOL fSet =
-#endif // GPOS_DEBUG
-		pbsCopy->ExchangeSet(pulElems[ulIndex]);
-	GPOS_ASSERT(!fSet);
+	ULLONG ullSubset = 0;
+	do
+	{
+		ullSubset = (ullSubset - ullNeighborhood) & ullNeighborhood;
+		EmitCsgCmp(ullCsg, ullCmp | ullSubset);
+	}
+	while (ullSubset != ullNeighborhood);
 
-	GenerateSubsets(mp, pbsCopy, pulElems, size, ulIndex + 1, pdrgpbsSubsets);
-	GenerateSubsets(mp, pbsCurrent, pulElems, size, ulIndex + 1, pdrgpbsSubsets);
+	const ULLONG ullExcludedRec = ullExcluded | ullNeighborhood;
+	ullSubset = 0;
+	do
+	{
+		ullSubset = (ullSubset - ullNeighborhood) & ullNeighborhood;
+		EnumerateCmpRec(ull, ullCsg, ullCmp | ullSubset, ullExcludedRec);
+	}
+	while (ullSubset != ullNeighborhood);
 }
 
+
 //---------------------------------------------------------------------------
 //	@function:
-//		CJoinOrderDP::PdrgpbsSubsets
+//		CJoinOrderDP::EmitCsgCmp
 //
 //	@doc:
-//		 Driver of subset generation
+//		Record a pair of a connected subset and a connected complement; all
+//		pairs making up a subset are recorded before the subset is paired
+//		with anything else
 //
 //---------------------------------------------------------------------------
-CBitSetArray *
-CJoinOrderDP::PdrgpbsSubsets
+void
+CJoinOrderDP::EmitCsgCmp
 	(
-	IMemoryPool *mp,
-	CBitSet *pbs
+	ULLONG ullCsg,
+	ULLONG ullCmp
 	)
 {
-	const ULONG size = pbs->Size();
-	ULONG *pulElems = GPOS_NEW_ARRAY(mp, ULONG, size);
-	ULONG ul = 0;
-	CBitSetIter bsi(*pbs);
-	while (bsi.Advance())
+	m_ulCsgCmpPairs++;
+
+	if (m_ulPairs == m_ulPairSlots)
 	{
-		pulElems[ul++] = bsi.Bit();
+		const ULONG ulPairSlots = std::max((ULONG) GPOPT_DP_JOIN_ORDERING_PAIR_SLOTS, 2 * m_ulPairSlots);
+		SCsgCmp *rgcsgcmp = GPOS_NEW_ARRAY(m_mp, SCsgCmp, ulPairSlots);
+		for (ULONG ul = 0; ul < m_ulPairs; ul++)
+		{
+			rgcsgcmp[ul] = m_rgcsgcmp[ul];
+		}
+
+		GPOS_DELETE_ARRAY(m_rgcsgcmp);
+		m_rgcsgcmp = rgcsgcmp;
+		m_ulPairSlots = ulPairSlots;
 	}
 
-	CBitSet *pbsCurrent = GPOS_NEW(mp) CBitSet(mp);
-	CBitSetArray *pdrgpbsSubsets = GPOS_NEW(mp) CBitSetArray(mp);
-	GenerateSubsets(mp, pbsCurrent, pulElems, size, 0, pdrgpbsSubsets);
-	GPOS_DELETE_ARRAY(pulElems);
+	m_rgcsgcmp[m_ulPairs].m_ullCsg = ullCsg;
+	m_rgcsgcmp[m_ulPairs].m_ullCmp = ullCmp;
+	m_ulPairs++;
+}
+
 
-	return pdrgpbsSubsets;
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::SolveCsgCmpPairs
+//
+//	@doc:
+//		Join the recorded pairs of the given set level by level, in the
+//		order of the number of components they join; pairs of the same
+//		level keep their enumeration order, so each subset gets the same
+//		best join order as when joining the pairs in enumeration order;
+//		the stats of all best join orders of a level are derived before
+//		the next level costs them, concurrently if there are several
+//		workers
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDP::SolveCsgCmpPairs
+	(
+	ULLONG ull
+	)
+{
+	const ULONG size = UlComponents(ull);
+
+	// derive the stats of the components needed by all joins upfront
+	for (ULLONG ullRest = ull; 0 != ullRest; ullRest &= ullRest - 1)
+	{
+		CExpression *pexprComp = m_rgpcomp[UlFirstComponent(ullRest)]->m_pexpr;
+		CColRefSet *pcrsStat = GPOS_NEW(m_mp) CColRefSet(m_mp, *m_prprelJoin->PcrsStat());
+		pcrsStat->Intersection(CDrvdPropRelational::GetRelationalProperties(pexprComp->PdpDerive())->PcrsOutput());
+		CReqdPropRelational *prprel = GPOS_NEW(m_mp) CReqdPropRelational(pcrsStat);
+		(void) pexprComp->PstatsDerive(prprel, NULL /*stats_ctxt*/);
+		prprel->Release();
+	}
+
+	// pairs of each level start after the pairs of all lower levels
+	ULONG *rgulStart = GPOS_NEW_ARRAY(m_mp, ULONG, size + 2);
+	ULONG *rgulNext = GPOS_NEW_ARRAY(m_mp, ULONG, size + 2);
+	for (ULONG ul = 0; ul < size + 2; ul++)
+	{
+		rgulStart[ul] = 0;
+	}
+
+	for (ULONG ul = 0; ul < m_ulPairs; ul++)
+	{
+		rgulStart[UlComponents(m_rgcsgcmp[ul].m_ullCsg | m_rgcsgcmp[ul].m_ullCmp) + 1]++;
+	}
+
+	for (ULONG ul = 1; ul < size + 2; ul++)
+	{
+		rgulStart[ul] += rgulStart[ul - 1];
+	}
+
+	for (ULONG ul = 0; ul < size + 2; ul++)
+	{
+		rgulNext[ul] = rgulStart[ul];
+	}
+
+	SCsgCmp *rgcsgcmp = GPOS_NEW_ARRAY(m_mp, SCsgCmp, std::max(m_ulPairs, (ULONG) 1));
+	for (ULONG ul = 0; ul < m_ulPairs; ul++)
+	{
+		rgcsgcmp[rgulNext[UlComponents(m_rgcsgcmp[ul].m_ullCsg | m_rgcsgcmp[ul].m_ullCmp)]++] = m_rgcsgcmp[ul];
+	}
+
+	for (ULONG ulLevel = 2; ulLevel <= size; ulLevel++)
+	{
+		ULLONG *rgullSolved = GPOS_NEW_ARRAY(m_mp, ULLONG, std::max(rgulStart[ulLevel + 1] - rgulStart[ulLevel], (ULONG) 1));
+		ULONG ulSolved = 0;
+		for (ULONG ul = rgulStart[ulLevel]; ul < rgulStart[ulLevel + 1]; ul++)
+		{
+			JoinCsgCmp(rgcsgcmp[ul].m_ullCsg, rgcsgcmp[ul].m_ullCmp, rgullSolved, &ulSolved);
+		}
+
+		CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+		for (ULONG ul = 0; ul < ulSolved; ul++)
+		{
+			CJoinOrderTable::SEntry *pentry = m_pjotBest->PentryFind(rgullSolved[ul]);
+			GPOS_ASSERT(NULL != pentry && pentry->m_fCosted);
+
+			InsertExpressionCost(pentry->m_pexpr, CDouble(pentry->m_dCost), false /*fValidateInsert*/);
+			pentry->m_pexpr->AddRef();
+			pdrgpexpr->Append(pentry->m_pexpr);
+		}
+
+		DeriveJoinOrderStats(pdrgpexpr);
+
+		pdrgpexpr->Release();
+		GPOS_DELETE_ARRAY(rgullSolved);
+	}
+
+	GPOS_DELETE_ARRAY(rgcsgcmp);
+	GPOS_DELETE_ARRAY(rgulNext);
+	GPOS_DELETE_ARRAY(rgulStart);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::JoinCsgCmp
+//
+//	@doc:
+//		Join the best join orders of a connected subset and a connected
+//		complement, and keep the result if it is the best join order of
+//		their union so far; unions getting their first join order are
+//		added to the given array of solved sets
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDP::JoinCsgCmp
+	(
+	ULLONG ullCsg,
+	ULLONG ullCmp,
+	ULLONG *rgullSolved,
+	ULONG *pulSolved
+	)
+{
+	GPOS_CHECK_ABORT;
+
+	// sides that are not connected by fully covered edges have no join order
+	CExpression *pexprFst = PexprLookup(ullCsg);
+	CExpression *pexprSnd = PexprLookup(ullCmp);
+	if (NULL == pexprFst || NULL == pexprSnd ||
+		m_pexprDummy == pexprFst || m_pexprDummy == pexprSnd ||
+		!FConnected(ullCsg, ullCmp))
+	{
+		return;
+	}
+
+	// cost the join as DCost does, without creating it
+	CDouble dCost(0.0);
+	dCost = dCost + DCostBest(ullCsg, pexprFst);
+	DeriveStats(pexprFst);
+	dCost = dCost + DCostBest(ullCmp, pexprSnd);
+	DeriveStats(pexprSnd);
+	dCost = dCost + (pexprFst->Pstats()->Rows().Get() + pexprSnd->Pstats()->Rows().Get());
+
+	const ULLONG ullJoin = ullCsg | ullCmp;
+	CExpression *pexprJoin = NULL;
+	CJoinOrderTable::SEntry *pentry = m_pjotBest->PentryInsert(ullJoin);
+	CExpression *pexprBest = pentry->m_pexpr;
+	if (NULL == pexprBest ||
+		m_pexprDummy == pexprBest ||
+		dCost < (pentry->m_fCosted ? CDouble(pentry->m_dCost) : DCost(pexprBest)))
+	{
+		if (NULL == pexprBest || m_pexprDummy == pexprBest)
+		{
+			rgullSolved[(*pulSolved)++] = ullJoin;
+		}
+
+		// creating the join only adds links, so the entry stays in place
+		pexprJoin = PexprJoin(ullCsg, ullCmp);
+		pexprJoin->AddRef();
+		CJoinOrderTable::SetExpression(pentry, pexprJoin, dCost);
+	}
+
+	if (m_ulComps == UlComponents(ullJoin))
+	{
+		if (NULL == pexprJoin)
+		{
+			pexprJoin = PexprJoin(ullCsg, ullCmp);
+		}
+
+		// keep both join directions as alternatives
+		AddJoinOrder(pexprJoin, dCost);
+		CExpression *pexprJoinCommuted = PexprJoin(ullCmp, ullCsg);
+		AddJoinOrder(pexprJoinCommuted, dCost);
+		pexprJoinCommuted->Release();
+	}
+
+	CRefCount::SafeRelease(pexprJoin);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::FConnected
+//
+//	@doc:
+//		Are the two given sets connected by an edge covered by their union
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinOrderDP::FConnected
+	(
+	ULLONG ullFst,
+	ULLONG ullSnd
+	)
+	const
+{
+	const ULLONG ull = ullFst | ullSnd;
+	for (ULONG ul = 0; ul < m_ulEdges; ul++)
+	{
+		const ULLONG ullEdge = m_rgpedge[ul]->m_ullCover;
+		if (0 == (ullEdge & ~ull) && 0 != (ullEdge & ullFst) && 0 != (ullEdge & ullSnd))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::DCostBest
+//
+//	@doc:
+//		Cost of the best join order of the given set, as computed by DCost
+//
+//---------------------------------------------------------------------------
+CDouble
+CJoinOrderDP::DCostBest
+	(
+	ULLONG ull,
+	CExpression *pexprBest
+	)
+{
+	if (1 < UlComponents(ull))
+	{
+		CJoinOrderTable::SEntry *pentry = m_pjotBest->PentryFind(ull);
+		GPOS_ASSERT(NULL != pentry && pexprBest == pentry->m_pexpr);
+
+		if (pentry->m_fCosted)
+		{
+			return CDouble(pentry->m_dCost);
+		}
+	}
+
+	return DCost(pexprBest);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::DeriveJoinOrderStats
+//
+//	@doc:
+//		Derive stats on the given join orders of connected subsets; their
+//		properties and the stats of their predicates are derived first, and
+//		the stats of their children cover the columns they need, so the
+//		tasks deriving their stats only read the shared children
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDP::DeriveJoinOrderStats
+	(
+	CExpressionArray *pdrgpexpr
+	)
+{
+	const ULONG ulExprs = pdrgpexpr->Size();
+	if (0 == ulExprs)
+	{
+		return;
+	}
+
+	for (ULONG ul = 0; ul < ulExprs; ul++)
+	{
+		CExpression *pexpr = (*pdrgpexpr)[ul];
+		(void) pexpr->PdpDerive();
+
+		const ULONG arity = pexpr->Arity();
+		for (ULONG ulChild = 0; ulChild < arity; ulChild++)
+		{
+			CExpression *pexprChild = (*pexpr)[ulChild];
+			if (pexprChild->Pop()->FScalar())
+			{
+				(void) pexprChild->PstatsDerive(m_prprelJoin, NULL /*stats_ctxt*/);
+			}
+		}
+	}
+
+	SStatsDerivation sd(pdrgpexpr, m_prprelJoin);
+	const ULONG ulTasks = std::min(m_ulWorkers, ulExprs) - 1;
+	if (0 == ulTasks)
+	{
+		(void) PvDeriveStats(&sd);
+		return;
+	}
+
+	CAutoTaskProxy atp(m_mp, CWorkerPoolManager::WorkerPoolManager());
+	CAutoRg<CTask*> a_rgptsk;
+	a_rgptsk = GPOS_NEW_ARRAY(m_mp, CTask*, ulTasks);
+	for (ULONG ul = 0; ul < ulTasks; ul++)
+	{
+		a_rgptsk[ul] = atp.Create(PvDeriveStats, &sd);
+
+		// store a pointer to optimizer's context in current task local storage
+		a_rgptsk[ul]->GetTls().Reset(m_mp);
+		a_rgptsk[ul]->GetTls().Store(COptCtxt::PoctxtFromTLS());
+	}
+
+	for (ULONG ul = 0; ul < ulTasks; ul++)
+	{
+		atp.Schedule(a_rgptsk[ul]);
+	}
+
+	// the current task takes its share too, so all stats are derived even
+	// if no worker is free to start the other tasks
+	(void) PvDeriveStats(&sd);
+
+	// tasks that have not started by now would find nothing left to do
+	for (ULONG ul = 0; ul < ulTasks; ul++)
+	{
+		if (CTask::EtsQueued == a_rgptsk[ul]->GetStatus())
+		{
+			atp.Cancel(a_rgptsk[ul]);
+		}
+	}
+
+	for (ULONG ul = 0; ul < ulTasks; ul++)
+	{
+		atp.Wait(a_rgptsk[ul]);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::PvDeriveStats
+//
+//	@doc:
+//		Derive stats on the expressions not yet taken by other tasks
+//
+//---------------------------------------------------------------------------
+void *
+CJoinOrderDP::PvDeriveStats
+	(
+	void *pv
+	)
+{
+	SStatsDerivation *psd = static_cast<SStatsDerivation *>(pv);
+	const ULONG ulExprs = psd->m_pdrgpexpr->Size();
+	for (ULONG ul = psd->m_aulNext.Incr(); ul < ulExprs; ul = psd->m_aulNext.Incr())
+	{
+		CExpression *pexpr = (*psd->m_pdrgpexpr)[ul];
+		if (NULL == pexpr->Pstats())
+		{
+			(void) pexpr->PstatsDerive(psd->m_prprel, NULL /*stats_ctxt*/);
+		}
+	}
+
+	return NULL;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDP::PexprBestJoinOrderDP
+//
+//	@doc:
+//		Find the best join order of a given set of elements using dynamic
+//		programming; small sets try all their splits, larger sets are solved
+//		over their connected subsets, and those of their subsets that can
+//		only be joined with cross products fall back to trying all splits
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinOrderDP::PexprBestJoinOrderDP
+	(
+	ULLONG ull // set of elements to be joined
+	)
+{
+	const ULONG size = UlComponents(ull);
+	if (GPOPT_DP_JOIN_ORDERING_SPLIT_LIMIT >= size &&
+		!GPOS_FTRACE(EopttraceForceConnectedSubgraphJoinOrderDP))
+	{
+		return PexprBestJoinOrderSplits(ull);
+	}
+
+	if (0 != (ull & ~m_ullEnumerated))
+	{
+		EnumerateCsgCmpPairs(ull);
+
+		if (0 == (m_ullEnumerated & ~ull))
+		{
+			m_ullEnumerated = ull;
+		}
+	}
+
+	CExpression *pexprResult = PexprLookup(ull);
+	if (NULL != pexprResult)
+	{
+		DeriveStats(pexprResult);
+		return pexprResult;
+	}
+
+	if (GPOPT_DP_JOIN_ORDERING_SPLIT_LIMIT >= size)
+	{
+		return PexprBestJoinOrderSplits(ull);
+	}
+
+	// too many splits to try
+	m_pexprDummy->AddRef();
+	InsertBest(ull, m_pexprDummy);
+
+	return m_pexprDummy;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrderDP::DCost
@@ -719,33 +1275,33 @@ CJoinOrderDP::DCost
 }
 
 
+
 //---------------------------------------------------------------------------
 //	@function:
-//		CJoinOrderDP::PbsCovered
+//		CJoinOrderDP::UllCovered
 //
 //	@doc:
 //		Return a subset of the given set covered by one or more edges
 //
 //---------------------------------------------------------------------------
-CBitSet *
-CJoinOrderDP::PbsCovered
+ULLONG
+CJoinOrderDP::UllCovered
 	(
-	CBitSet *pbsInput
+	ULLONG ullInput
 	)
+	const
 {
-	GPOS_ASSERT(NULL != pbsInput);
-	CBitSet *pbs = GPOS_NEW(m_mp) CBitSet(m_mp);
-
+	ULLONG ull = 0;
 	for (ULONG ul = 0; ul < m_ulEdges; ul++)
 	{
-		SEdge *pedge = m_rgpedge[ul];
-		if (pbsInput->ContainsAll(pedge->m_pbs))
+		ULLONG ullEdge = m_rgpedge[ul]->m_ullCover;
+		if (0 == (ullEdge & ~ullInput))
 		{
-			pbs->Union(pedge->m_pbs);
+			ull |= ullEdge;
 		}
 	}
 
-	return pbs;
+	return ull;
 }
 
 
@@ -760,36 +1316,28 @@ CJoinOrderDP::PbsCovered
 CExpression *
 CJoinOrderDP::PexprCross
 	(
-	CBitSet *pbs
+	ULLONG ull
 	)
 {
-	GPOS_ASSERT(NULL != pbs);
-
-	CExpression *pexpr = PexprLookup(pbs);
+	CExpression *pexpr = PexprLookup(ull);
 	if (NULL != pexpr)
 	{
 		// join order is already created
 		return pexpr;
 	}
 
-	CBitSetIter bsi(*pbs);
-	(void) bsi.Advance();
-	CExpression *pexprComp = m_rgpcomp[bsi.Bit()]->m_pexpr;
+	ULLONG ullRest = ull;
+	CExpression *pexprComp = m_rgpcomp[UlFirstComponent(ullRest)]->m_pexpr;
 	pexprComp->AddRef();
 	CExpression *pexprCross = pexprComp;
-	while (bsi.Advance())
+	for (ullRest &= ullRest - 1; 0 != ullRest; ullRest &= ullRest - 1)
 	{
-		pexprComp =  m_rgpcomp[bsi.Bit()]->m_pexpr;
+		pexprComp =  m_rgpcomp[UlFirstComponent(ullRest)]->m_pexpr;
 		pexprComp->AddRef();
 		pexprCross = CUtils::PexprLogicalJoin<CLogicalInnerJoin>(m_mp, pexprComp, pexprCross, CPredicateUtils::PexprConjunction(m_mp, NULL /*pdrgpexpr*/));
 	}
 
-	pbs->AddRef();
-#ifdef GPOS_DEBUG
-		BOOL fInserted =
-#endif // GPOS_DEBUG
-			m_phmbsexpr->Insert(pbs, pexprCross);
-		GPOS_ASSERT(fInserted);
+	InsertBest(ull, pexprCross);
 
 	return pexprCross;
 }
@@ -806,38 +1354,30 @@ CJoinOrderDP::PexprCross
 CExpression *
 CJoinOrderDP::PexprJoinCoveredSubsetWithUncoveredSubset
 	(
-	CBitSet *pbs,
-	CBitSet *pbsCovered,
-	CBitSet *pbsUncovered
+	ULLONG ull,
+	ULLONG ullCovered,
+	ULLONG ullUncovered
 	)
 {
-	GPOS_ASSERT(NULL != pbs);
-	GPOS_ASSERT(NULL != pbsCovered);
-	GPOS_ASSERT(NULL != pbsUncovered);
-	GPOS_ASSERT(pbsCovered->IsDisjoint(pbsUncovered));
-	GPOS_ASSERT(pbs->ContainsAll(pbsCovered));
-	GPOS_ASSERT(pbs->ContainsAll(pbsUncovered));
+	GPOS_ASSERT(0 == (ullCovered & ullUncovered));
+	GPOS_ASSERT(0 == (ullCovered & ~ull));
+	GPOS_ASSERT(0 == (ullUncovered & ~ull));
 
 	// find best join order for covered subset
-	CExpression *pexprJoin = PexprBestJoinOrder(pbsCovered);
+	CExpression *pexprJoin = PexprBestJoinOrder(ullCovered);
 	if (NULL == pexprJoin)
 	{
 		return NULL;
 	}
 
 	// create a cross product for uncovered subset
-	CExpression *pexprCross = PexprCross(pbsUncovered);
+	CExpression *pexprCross = PexprCross(ullUncovered);
 
 	// join the results with a cross product
 	pexprJoin->AddRef();
 	pexprCross->AddRef();
 	CExpression *pexprResult = CUtils::PexprLogicalJoin<CLogicalInnerJoin>(m_mp, pexprJoin, pexprCross, CPredicateUtils::PexprConjunction(m_mp, NULL));
-	pbs->AddRef();
-#ifdef GPOS_DEBUG
-	BOOL fInserted =
-#endif // GPOS_DEBUG
-		m_phmbsexpr->Insert(pbs, pexprResult);
-	GPOS_ASSERT(fInserted);
+	InsertBest(ull, pexprResult);
 
 	return pexprResult;
 }
@@ -854,16 +1394,16 @@ CJoinOrderDP::PexprJoinCoveredSubsetWithUncoveredSubset
 CExpression *
 CJoinOrderDP::PexprBestJoinOrder
 	(
-	CBitSet *pbs
+	ULLONG ull
 	)
 {
 	GPOS_CHECK_STACK_SIZE;
 	GPOS_CHECK_ABORT;
 
-	GPOS_ASSERT(NULL != pbs);
+	GPOS_ASSERT(0 != ull);
 
 	// start by looking-up cost in the DP map
-	CExpression *pexpr = PexprLookup(pbs);
+	CExpression *pexpr = PexprLookup(ull);
 
 	if (pexpr == m_pexprDummy)
 	{
@@ -878,37 +1418,27 @@ CJoinOrderDP::PexprBestJoinOrder
 	}
 
 	// find maximal covered subset
-	CBitSet *pbsCovered = PbsCovered(pbs);
-	if (0 == pbsCovered->Size())
+	ULLONG ullCovered = UllCovered(ull);
+	if (0 == ullCovered)
 	{
 		// set is not covered, return a cross product
-		pbsCovered->Release();
-
-		return PexprCross(pbs);
+		return PexprCross(ull);
 	}
 
-	if (!pbsCovered->Equals(pbs))
+	if (ullCovered != ull)
 	{
 		// create a cross product for uncovered subset
-		CBitSet *pbsUncovered = GPOS_NEW(m_mp) CBitSet(m_mp, *pbs);
-		pbsUncovered->Difference(pbsCovered);
-		CExpression *pexprResult =
-			PexprJoinCoveredSubsetWithUncoveredSubset(pbs, pbsCovered, pbsUncovered);
-		pbsCovered->Release();
-		pbsUncovered->Release();
-
-		return pexprResult;
+		return PexprJoinCoveredSubsetWithUncoveredSubset(ull, ullCovered, ull & ~ullCovered);
 	}
-	pbsCovered->Release();
 
 	// if set has size 2, there is only one possible solution
-	if (2 == pbs->Size())
+	if (2 == UlComponents(ull))
 	{
-		return PexprJoin(pbs);
+		return PexprJoin(ull);
 	}
 
 	// otherwise, compute best join order using dynamic programming
-	CExpression *pexprBestJoinOrder = PexprBestJoinOrderDP(pbs);
+	CExpression *pexprBestJoinOrder = PexprBestJoinOrderDP(ull);
 	if (pexprBestJoinOrder == m_pexprDummy)
 	{
 		// no join order could be created
@@ -930,51 +1460,38 @@ CJoinOrderDP::PexprBestJoinOrder
 CExpression *
 CJoinOrderDP::PexprBuildPred
 	(
-	CBitSet *pbsFst,
-	CBitSet *pbsSnd
+	ULLONG ullFst,
+	ULLONG ullSnd
 	)
 {
 	// collect edges connecting the given sets
-	CBitSet *pbsEdges = GPOS_NEW(m_mp) CBitSet(m_mp);
-	CBitSet *pbs = GPOS_NEW(m_mp) CBitSet(m_mp, *pbsFst);
-	pbs->Union(pbsSnd);
-
+	const ULLONG ull = ullFst | ullSnd;
+	CExpressionArray *pdrgpexpr = NULL;
 	for (ULONG ul = 0; ul < m_ulEdges; ul++)
 	{
 		SEdge *pedge = m_rgpedge[ul];
+		const ULLONG ullEdge = pedge->m_ullCover;
 		if (
-			pbs->ContainsAll(pedge->m_pbs) &&
-			!pbsFst->IsDisjoint(pedge->m_pbs) &&
-			!pbsSnd->IsDisjoint(pedge->m_pbs)
+			0 == (ullEdge & ~ull) &&
+			0 != (ullEdge & ullFst) &&
+			0 != (ullEdge & ullSnd)
 			)
 		{
-#ifdef GPOS_DEBUG
-		BOOL fSet =
-#endif // GPOS_DEBUG
-			pbsEdges->ExchangeSet(ul);
-			GPOS_ASSERT(!fSet);
-		}
-	}
-	pbs->Release();
-
-	CExpression *pexprPred = NULL;
-	if (0 < pbsEdges->Size())
-	{
-		CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
-		CBitSetIter bsi(*pbsEdges);
-		while (bsi.Advance())
-		{
-			ULONG ul = bsi.Bit();
-			SEdge *pedge = m_rgpedge[ul];
+			if (NULL == pdrgpexpr)
+			{
+				pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+			}
 			pedge->m_pexpr->AddRef();
 			pdrgpexpr->Append(pedge->m_pexpr);
 		}
+	}
 
-		pexprPred = CPredicateUtils::PexprConjunction(m_mp, pdrgpexpr);
+	if (NULL == pdrgpexpr)
+	{
+		return NULL;
 	}
 
-	pbsEdges->Release();
-	return pexprPred;
+	return CPredicateUtils::PexprConjunction(m_mp, pdrgpexpr);
 }
 
 
@@ -989,18 +1506,17 @@ CJoinOrderDP::PexprBuildPred
 CExpression *
 CJoinOrderDP::PexprExpand()
 {
-	CBitSet *pbs = GPOS_NEW(m_mp) CBitSet(m_mp);
+	ULLONG ull = 0;
 	for (ULONG ul = 0; ul < m_ulComps; ul++)
 	{
-		(void) pbs->ExchangeSet(ul);
+		ull |= UllComponent(ul);
 	}
 
-	CExpression *pexprResult = PexprBestJoinOrder(pbs);
+	CExpression *pexprResult = PexprBestJoinOrder(ull);
 	if (NULL != pexprResult)
 	{
 		pexprResult->AddRef();
 	}
-	pbs->Release();
 
 	return pexprResult;
 }
@@ -1024,4 +1540,5 @@ CJoinOrderDP::OsPrint
 	return os;
 }
 
+
 // EOF
@@ -19,6 +19,7 @@
 #include "gpos/common/CBitSet.h"
 
 #include "gpopt/base/CDrvdPropScalar.h"
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/operators/ops.h"
@@ -81,6 +82,10 @@ CJoinOrderGreedy::GetStartingJoins()
 	ULONG ul2Counter = 0;
 	CJoinOrder::SComponent *pcompBest = GPOS_NEW(m_mp) SComponent(m_mp, NULL /*pexpr*/);
 
+	// once the optimization budget is exceeded, start with the first pair
+	// that is not a cross join
+	const BOOL fBudgetExceeded = COptCtxt::PoctxtFromTLS()->FBudgetExceeded();
+
 	for (ULONG ul1 = 0; ul1 < m_ulComps; ul1++)
 	{
 		for (ULONG ul2 = ul1+1; ul2 < m_ulComps; ul2++)
@@ -101,8 +106,12 @@ CJoinOrderGreedy::GetStartingJoins()
 				compTemp->Release();
 				continue;
 			}
-			DeriveStats(compTemp->m_pexpr);
-			CDouble dRows = compTemp->m_pexpr->Pstats()->Rows();
+			CDouble dRows(1.0);
+			if (!fBudgetExceeded)
+			{
+				DeriveCoverStats(compTemp->m_pexpr, compTemp->m_ullCover);
+				dRows = compTemp->m_pexpr->Pstats()->Rows();
+			}
 			if (dMinRows <= 0 || dRows < dMinRows)
 			{
 				ul1Counter = ul1;
@@ -231,6 +240,9 @@ CJoinOrderGreedy::PickBestJoin
 	CDouble dMinRows = 0.0;
 	ULONG best_comp_idx = gpos::ulong_max;
 
+	// once the optimization budget is exceeded, pick the first candidate
+	const BOOL fBudgetExceeded = COptCtxt::PoctxtFromTLS()->FBudgetExceeded();
+
 	CBitSetIter iter(*candidate_comp_set);
 	while (iter.Advance())
 	{
@@ -241,8 +253,12 @@ CJoinOrderGreedy::PickBestJoin
 		}
 
 		SComponent *pcompTemp = PcompCombine(m_pcompResult, pcompCurrent);
-		DeriveStats(pcompTemp->m_pexpr);
-		CDouble dRows = pcompTemp->m_pexpr->Pstats()->Rows();
+		CDouble dRows(0.0);
+		if (!fBudgetExceeded)
+		{
+			DeriveCoverStats(pcompTemp->m_pexpr, pcompTemp->m_ullCover);
+			dRows = pcompTemp->m_pexpr->Pstats()->Rows();
+		}
 
 		// pick the component which will give the lowest cardinality
 		if (NULL == pcompBestComponent || dRows < dMinRows)
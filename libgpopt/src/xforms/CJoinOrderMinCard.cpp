@@ -18,6 +18,7 @@
 #include "gpos/common/CBitSet.h"
 
 #include "gpopt/base/CDrvdPropScalar.h"
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/operators/ops.h"
@@ -90,6 +91,10 @@ CJoinOrderMinCard::PexprExpand()
 		SComponent *pcompBest = NULL; // best component to be added to current result
 		SComponent *pcompBestResult = NULL; // result after adding best component
 
+		// once the optimization budget is exceeded, components are no longer
+		// compared by cardinality, only cross joins are avoided
+		const BOOL fBudgetExceeded = COptCtxt::PoctxtFromTLS()->FBudgetExceeded();
+
 		for (ULONG ul = 0; ul < m_ulComps; ul++)
 		{
 			SComponent *pcompCurrent = m_rgpcomp[ul];
@@ -106,8 +111,16 @@ CJoinOrderMinCard::PexprExpand()
 
 			// combine component with current result and derive stats
 			CJoinOrder::SComponent *pcompTemp = PcompCombine(m_pcompResult, pcompCurrent);
-			DeriveStats(pcompTemp->m_pexpr);
-			CDouble rows = pcompTemp->m_pexpr->Pstats()->Rows();
+			CDouble rows(0.0);
+			if (fBudgetExceeded)
+			{
+				rows = CUtils::FCrossJoin(pcompTemp->m_pexpr) ? 1.0 : 0.0;
+			}
+			else
+			{
+				DeriveCoverStats(pcompTemp->m_pexpr, pcompTemp->m_ullCover);
+				rows = pcompTemp->m_pexpr->Pstats()->Rows();
+			}
 
 			if (NULL == pcompBestResult || rows < dMinRows)
 			{
@@ -0,0 +1,254 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CJoinOrderTable.cpp
+//
+//	@doc:
+//		Implementation of open-addressed table of join expressions
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CJoinOrderTable.h"
+
+using namespace gpopt;
+
+// multiplier of Fibonacci hashing, 2^64 divided by the golden ratio
+#define GPOPT_JOIN_ORDER_TABLE_HASH_MULTIPLIER ((((ULLONG) 0x9E3779B9) << 32) | (ULLONG) 0x7F4A7C15)
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTable::CJoinOrderTable
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CJoinOrderTable::CJoinOrderTable
+	(
+	IMemoryPool *mp,
+	ULONG ulSlots
+	)
+	:
+	m_mp(mp),
+	m_rgentry(NULL),
+	m_ulSlots(2),
+	m_ulEntries(0)
+{
+	while (m_ulSlots < ulSlots)
+	{
+		m_ulSlots *= 2;
+	}
+
+	m_rgentry = GPOS_NEW_ARRAY(m_mp, SEntry, m_ulSlots);
+	for (ULONG ul = 0; ul < m_ulSlots; ul++)
+	{
+		m_rgentry[ul].m_ullFst = 0;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTable::~CJoinOrderTable
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CJoinOrderTable::~CJoinOrderTable()
+{
+	for (ULONG ul = 0; ul < m_ulSlots; ul++)
+	{
+		if (0 != m_rgentry[ul].m_ullFst)
+		{
+			CRefCount::SafeRelease(m_rgentry[ul].m_pexpr);
+		}
+	}
+
+	GPOS_DELETE_ARRAY(m_rgentry);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTable::UlProbe
+//
+//	@doc:
+//		Index of the entry with the given keys, or of the empty entry where
+//		they are to be inserted
+//
+//---------------------------------------------------------------------------
+ULONG
+CJoinOrderTable::UlProbe
+	(
+	ULLONG ullFst,
+	ULLONG ullSnd
+	)
+	const
+{
+	GPOS_ASSERT(0 != ullFst);
+
+	// the high bits of the product depend on all bits of the keys
+	ULLONG ullHash = (ullFst ^ (ullSnd * GPOPT_JOIN_ORDER_TABLE_HASH_MULTIPLIER)) * GPOPT_JOIN_ORDER_TABLE_HASH_MULTIPLIER;
+	const ULONG ulMask = m_ulSlots - 1;
+	ULONG ul = ((ULONG) (ullHash >> 32)) & ulMask;
+	while (0 != m_rgentry[ul].m_ullFst &&
+		   (ullFst != m_rgentry[ul].m_ullFst || ullSnd != m_rgentry[ul].m_ullSnd))
+	{
+		ul = (ul + 1) & ulMask;
+	}
+
+	return ul;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTable::Grow
+//
+//	@doc:
+//		Double the number of entries and reinsert the used ones
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderTable::Grow()
+{
+	SEntry *rgentryOld = m_rgentry;
+	const ULONG ulSlotsOld = m_ulSlots;
+
+	m_ulSlots *= 2;
+	m_rgentry = GPOS_NEW_ARRAY(m_mp, SEntry, m_ulSlots);
+	for (ULONG ul = 0; ul < m_ulSlots; ul++)
+	{
+		m_rgentry[ul].m_ullFst = 0;
+	}
+
+	for (ULONG ul = 0; ul < ulSlotsOld; ul++)
+	{
+		if (0 != rgentryOld[ul].m_ullFst)
+		{
+			m_rgentry[UlProbe(rgentryOld[ul].m_ullFst, rgentryOld[ul].m_ullSnd)] = rgentryOld[ul];
+		}
+	}
+
+	GPOS_DELETE_ARRAY(rgentryOld);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTable::PentryFind
+//
+//	@doc:
+//		Lookup entry with the given keys
+//
+//---------------------------------------------------------------------------
+CJoinOrderTable::SEntry *
+CJoinOrderTable::PentryFind
+	(
+	ULLONG ullFst,
+	ULLONG ullSnd
+	)
+	const
+{
+	SEntry *pentry = &m_rgentry[UlProbe(ullFst, ullSnd)];
+	if (0 == pentry->m_ullFst)
+	{
+		return NULL;
+	}
+
+	return pentry;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTable::PentryInsert
+//
+//	@doc:
+//		Lookup entry with the given keys, adding an entry without an
+//		expression if not found
+//
+//---------------------------------------------------------------------------
+CJoinOrderTable::SEntry *
+CJoinOrderTable::PentryInsert
+	(
+	ULLONG ullFst,
+	ULLONG ullSnd
+	)
+{
+	ULONG ul = UlProbe(ullFst, ullSnd);
+	if (0 != m_rgentry[ul].m_ullFst)
+	{
+		return &m_rgentry[ul];
+	}
+
+	// keep at least half of the entries empty so probe sequences stay short
+	if (2 * (m_ulEntries + 1) > m_ulSlots)
+	{
+		Grow();
+		ul = UlProbe(ullFst, ullSnd);
+	}
+
+	SEntry *pentry = &m_rgentry[ul];
+	pentry->m_ullFst = ullFst;
+	pentry->m_ullSnd = ullSnd;
+	pentry->m_pexpr = NULL;
+	pentry->m_dCost = 0.0;
+	pentry->m_fCosted = false;
+	m_ulEntries++;
+
+	return pentry;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTable::SetExpression
+//
+//	@doc:
+//		Set the expression of an entry, its cost becomes unknown
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderTable::SetExpression
+	(
+	SEntry *pentry,
+	CExpression *pexpr
+	)
+{
+	GPOS_ASSERT(NULL != pentry);
+	GPOS_ASSERT(NULL != pexpr);
+
+	CRefCount::SafeRelease(pentry->m_pexpr);
+	pentry->m_pexpr = pexpr;
+	pentry->m_dCost = 0.0;
+	pentry->m_fCosted = false;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTable::SetExpression
+//
+//	@doc:
+//		Set the expression of an entry and its cost
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderTable::SetExpression
+	(
+	SEntry *pentry,
+	CExpression *pexpr,
+	CDouble dCost
+	)
+{
+	SetExpression(pentry, pexpr);
+	pentry->m_dCost = dCost.Get();
+	pentry->m_fCosted = true;
+}
+
+// EOF
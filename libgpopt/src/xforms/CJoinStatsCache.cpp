@@ -0,0 +1,242 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CJoinStatsCache.cpp
+//
+//	@doc:
+//		Implementation of cache of join statistics
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpos/sync/CAutoMutex.h"
+
+#include "gpopt/search/CGroupExpression.h"
+#include "gpopt/xforms/CJoinStatsCache.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::SEntry::SEntry
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CJoinStatsCache::SEntry::SEntry
+	(
+	CExpression *pexpr,
+	IStatistics *stats
+	)
+	:
+	m_pexpr(pexpr),
+	m_pstats(stats),
+	m_pentryNext(NULL)
+{
+	GPOS_ASSERT(NULL != pexpr);
+	GPOS_ASSERT(NULL != stats);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::SEntry::~SEntry
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CJoinStatsCache::SEntry::~SEntry()
+{
+	m_pexpr->Release();
+	m_pstats->Release();
+	CRefCount::SafeRelease(m_pentryNext);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::CJoinStatsCache
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CJoinStatsCache::CJoinStatsCache
+	(
+	IMemoryPool *mp
+	)
+	:
+	m_mp(mp),
+	m_phmullentry(NULL),
+	m_ulLookups(0),
+	m_ulHits(0)
+{
+	GPOS_ASSERT(NULL != mp);
+
+	m_phmullentry = GPOS_NEW(m_mp) UllToEntryMap(m_mp);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::~CJoinStatsCache
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CJoinStatsCache::~CJoinStatsCache()
+{
+	m_phmullentry->Release();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::FIdentical
+//
+//	@doc:
+//		Are the two join trees identical; unlike CUtils::Equals, children
+//		are always compared in order, and leaves bound to memo groups only
+//		match leaves bound to the same group
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinStatsCache::FIdentical
+	(
+	const CExpression *pexprFst,
+	const CExpression *pexprSnd
+	)
+{
+	GPOS_CHECK_STACK_SIZE;
+
+	if (pexprFst == pexprSnd)
+	{
+		return true;
+	}
+
+	const ULONG arity = pexprFst->Arity();
+	if (arity != pexprSnd->Arity() || !pexprFst->Pop()->Matches(pexprSnd->Pop()))
+	{
+		return false;
+	}
+
+	CGroupExpression *pgexprFst = pexprFst->Pgexpr();
+	CGroupExpression *pgexprSnd = pexprSnd->Pgexpr();
+	if (NULL != pgexprFst || NULL != pgexprSnd)
+	{
+		if (NULL == pgexprFst || NULL == pgexprSnd ||
+			pgexprFst->Pgroup() != pgexprSnd->Pgroup())
+		{
+			return false;
+		}
+	}
+
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		if (!FIdentical((*pexprFst)[ul], (*pexprSnd)[ul]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::PstatsLookup
+//
+//	@doc:
+//		Lookup statistics of a join identical to the given one
+//
+//---------------------------------------------------------------------------
+IStatistics *
+CJoinStatsCache::PstatsLookup
+	(
+	ULLONG ullCover,
+	const CExpression *pexpr
+	)
+{
+	GPOS_ASSERT(NULL != pexpr);
+
+	CAutoMutex am(m_mutex);
+	am.Lock();
+
+	m_ulLookups++;
+	for (SEntry *pentry = m_phmullentry->Find(&ullCover); NULL != pentry; pentry = pentry->m_pentryNext)
+	{
+		if (FIdentical(pentry->m_pexpr, pexpr))
+		{
+			m_ulHits++;
+			pentry->m_pstats->AddRef();
+
+			return pentry->m_pstats;
+		}
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::Insert
+//
+//	@doc:
+//		Cache the statistics derived on the given join; a join identical to
+//		one already cached, e.g. when another xform derived it concurrently,
+//		is not cached again
+//
+//---------------------------------------------------------------------------
+void
+CJoinStatsCache::Insert
+	(
+	ULLONG ullCover,
+	CExpression *pexpr
+	)
+{
+	GPOS_ASSERT(NULL != pexpr);
+	GPOS_ASSERT(NULL != pexpr->Pstats());
+
+	CAutoMutex am(m_mutex);
+	am.Lock();
+
+	SEntry *pentryHead = m_phmullentry->Find(&ullCover);
+	for (SEntry *pentry = pentryHead; NULL != pentry; pentry = pentry->m_pentryNext)
+	{
+		if (FIdentical(pentry->m_pexpr, pexpr))
+		{
+			return;
+		}
+	}
+
+	// the expression may derive more statistics later on, so keep a
+	// reference to the statistics derived so far
+	IStatistics *stats = const_cast<IStatistics *>(pexpr->Pstats());
+	pexpr->AddRef();
+	stats->AddRef();
+	SEntry *pentryNew = GPOS_NEW(m_mp) SEntry(pexpr, stats);
+
+	if (NULL == pentryHead)
+	{
+#ifdef GPOS_DEBUG
+		BOOL fInserted =
+#endif // GPOS_DEBUG
+			m_phmullentry->Insert(GPOS_NEW(m_mp) ULLONG(ullCover), pentryNew);
+		GPOS_ASSERT(fInserted);
+
+		return;
+	}
+
+	// chain new entry after the head of the chain, which the map owns
+	pentryNew->m_pentryNext = pentryHead->m_pentryNext;
+	pentryHead->m_pentryNext = pentryNew;
+}
+
+// EOF
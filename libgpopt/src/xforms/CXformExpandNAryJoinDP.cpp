@@ -77,7 +77,9 @@ CXformExpandNAryJoinDP::Exfp
 	// defining the join predicate, ignore it.
 	const ULONG ulRelChild = arity - 1;
 
-	if (ulRelChild > phint->UlJoinOrderDPLimit())
+	// sets of components are kept as bit masks during dynamic programming
+	if (ulRelChild > phint->UlJoinOrderDPLimit() ||
+		ulRelChild > GPOPT_JOIN_ORDER_MASK_COMPONENTS)
 	{
 		return CXform::ExfpNone;
 	}
@@ -127,6 +129,7 @@ CXformExpandNAryJoinDP::Transform
 
 	// create join order using dynamic programming
 	CJoinOrderDP jodp(mp, pdrgpexpr, pdrgpexprPreds);
+	jodp.SetStatsCache(CLogicalNAryJoin::PopConvert(pexpr->Pop())->Pjsc());
 	CExpression *pexprResult = jodp.PexprExpand();
 
 	if (NULL != pexprResult)
@@ -111,6 +111,7 @@ CXformExpandNAryJoinGreedy::Transform
 
 	// create a join order based on cardinality of intermediate results
 	CJoinOrderGreedy jomc(pmp, pdrgpexpr, pdrgpexprPreds);
+	jomc.SetStatsCache(CLogicalNAryJoin::PopConvert(pexpr->Pop())->Pjsc());
 	CExpression *pexprResult = jomc.PexprExpand();
 
 	// normalize resulting expression
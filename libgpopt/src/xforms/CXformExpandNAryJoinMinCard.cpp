@@ -110,6 +110,7 @@ CXformExpandNAryJoinMinCard::Transform
 
 	// create a join order based on cardinality of intermediate results
 	CJoinOrderMinCard jomc(mp, pdrgpexpr, pdrgpexprPreds);
+	jomc.SetStatsCache(CLogicalNAryJoin::PopConvert(pexpr->Pop())->Pjsc());
 	CExpression *pexprResult = jomc.PexprExpand();
 
 	// normalize resulting expression
@@ -0,0 +1,407 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CStripedHashtable.h
+//
+//	@doc:
+//		Resizable hashtable synchronized by lock striping;
+//
+//		1)	entries are partitioned into a fixed number of stripes, each
+//			stripe is protected by its own spinlock and owns a private
+//			range of hash buckets;
+//		2)	a stripe doubles its buckets when its load factor is exceeded;
+//			growing only locks the growing stripe, accesses to other
+//			stripes are never blocked by a resize;
+//		3)	a key's slot is its hash value modulo the initial number of
+//			buckets of the whole table; growing splits the buckets of a slot
+//			by the remaining bits of the hash value but never moves an entry
+//			to another slot, so draining the table visits slots in the same
+//			order as a fixed-size table of the initial size would;
+//		4)	like CSyncHashtable, expects target type to have SLink and Key
+//			members and clients to provide their own hash function; unlike
+//			CSyncHashtable, inserting may allocate memory;
+//---------------------------------------------------------------------------
+#ifndef GPOS_CStripedHashtable_H
+#define GPOS_CStripedHashtable_H
+
+#include "gpos/base.h"
+
+#include "gpos/common/CList.h"
+#include "gpos/sync/CAutoSpinlock.h"
+
+// maximum average number of entries per bucket before a stripe grows
+#define GPOS_STRIPED_HT_MAX_LOAD	2
+
+namespace gpos
+{
+
+	// prototypes
+	template <class T, class K, class S>
+	class CStripedHashtableAccessByKey;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStripedHashtable<T, K, S>
+	//
+	//	@doc:
+	//		Striped hashtable; a key is mapped to a slot by its hash value
+	//		modulo the initial number of buckets, slots are spread round-robin
+	//		across stripes, and a slot's entries are split among the slot's
+	//		buckets within the stripe by the remaining bits of the hash value
+	//
+	//---------------------------------------------------------------------------
+	template <class T, class K, class S>
+	class CStripedHashtable
+	{
+		// accessor is friend
+		friend class CStripedHashtableAccessByKey<T, K, S>;
+
+		private:
+
+			// stripe is a spinlock protecting a resizable range of hash chains
+			struct SStripe
+			{
+				private:
+
+					// no copy ctor
+					SStripe(const SStripe &);
+
+				public:
+
+					// ctor
+					SStripe()
+						:
+						m_buckets(NULL),
+						m_nbuckets(0),
+						m_size(0)
+					{}
+
+					// spinlock to protect stripe
+					S m_lock;
+
+					// hash chains
+					CList<T> *m_buckets;
+
+					// number of hash chains
+					ULONG m_nbuckets;
+
+					// number of entries in stripe
+					ULONG m_size;
+
+			};
+
+			// memory pool for stripes and buckets
+			IMemoryPool *m_mp;
+
+			// range of stripes
+			SStripe *m_stripes;
+
+			// number of stripes
+			ULONG m_nstripes;
+
+			// initial number of buckets per stripe
+			ULONG m_nbuckets_init;
+
+			// offset of link
+			ULONG m_link_offset;
+
+			// offset of key
+			ULONG m_key_offset;
+
+			// invalid key
+			const K *m_invalid_key;
+
+			// pointer to hashing function
+			ULONG (*m_hashfn)(const K&);
+
+			// pointer to key equality function
+			BOOL (*m_eqfn)(const K&, const K&);
+
+			// private copy ctor
+			CStripedHashtable(const CStripedHashtable<T, K, S> &);
+
+			// function to compute slot for hash value
+			ULONG GetSlot
+				(
+				ULONG hash
+				)
+				const
+			{
+				return hash % (m_nstripes * m_nbuckets_init);
+			}
+
+			// function to compute stripe index for hash value
+			ULONG GetStripeIndex
+				(
+				ULONG hash
+				)
+				const
+			{
+				return GetSlot(hash) % m_nstripes;
+			}
+
+			// function to compute index of a slot's bucket within a stripe
+			// of the given size; a slot owns every m_nbuckets_init-th bucket
+			// of its stripe, starting at slot_bucket
+			ULONG GetBucketIndex
+				(
+				ULONG nbuckets,
+				ULONG slot_bucket,
+				ULONG hash
+				)
+				const
+			{
+				GPOS_ASSERT(slot_bucket < m_nbuckets_init);
+
+				const ULONG splits = nbuckets / m_nbuckets_init;
+				const ULONG split = (hash / (m_nstripes * m_nbuckets_init)) % splits;
+
+				return slot_bucket + split * m_nbuckets_init;
+			}
+
+			// function to compute bucket index within stripe for hash value
+			ULONG GetBucketIndex
+				(
+				const SStripe &stripe,
+				ULONG hash
+				)
+				const
+			{
+				return GetBucketIndex(stripe.m_nbuckets, GetSlot(hash) / m_nstripes, hash);
+			}
+
+			// function to get stripe by hash value
+			SStripe &GetStripe
+				(
+				ULONG hash
+				)
+				const
+			{
+				return m_stripes[GetStripeIndex(hash)];
+			}
+
+			// function to get hash chain of hash value in given stripe
+			CList<T> &GetBucket
+				(
+				const SStripe &stripe,
+				ULONG hash
+				)
+				const
+			{
+				return stripe.m_buckets[GetBucketIndex(stripe, hash)];
+			}
+
+			// extract key out of type
+			K &Key
+				(
+				T *value
+				)
+				const
+			{
+				GPOS_ASSERT(gpos::ulong_max != m_key_offset &&
+							"Key offset not initialized.");
+
+				K &k = *(K*)((BYTE*)value + m_key_offset);
+
+				return k;
+			}
+
+			// key validity check
+			BOOL IsValid
+				(
+				const K &key
+				)
+				const
+			{
+				return !m_eqfn(key, *m_invalid_key);
+			}
+
+			// allocate and initialize a range of hash chains
+			CList<T> *PlistAllocBuckets
+				(
+				ULONG nbuckets
+				)
+				const
+			{
+				CList<T> *buckets = GPOS_NEW_ARRAY(m_mp, CList<T>, nbuckets);
+				for (ULONG i = 0; i < nbuckets; i++)
+				{
+					buckets[i].Init(m_link_offset);
+				}
+
+				return buckets;
+			}
+
+			// double the number of hash chains of a stripe; entries keep
+			// their slot and their relative order within each chain;
+			// caller must hold the stripe's spinlock
+			void Grow
+				(
+				SStripe &stripe
+				)
+			{
+				// allocate first, so that stripe is left intact if we run out of memory
+				const ULONG nbuckets = 2 * stripe.m_nbuckets;
+				CList<T> *buckets = PlistAllocBuckets(nbuckets);
+
+				for (ULONG i = 0; i < stripe.m_nbuckets; i++)
+				{
+					CList<T> &chain = stripe.m_buckets[i];
+					while (!chain.IsEmpty())
+					{
+						T *value = chain.RemoveHead();
+						ULONG hash = m_hashfn(Key(value));
+						buckets[GetBucketIndex(nbuckets, i % m_nbuckets_init, hash)].Append(value);
+					}
+				}
+
+				GPOS_DELETE_ARRAY(stripe.m_buckets);
+				stripe.m_buckets = buckets;
+				stripe.m_nbuckets = nbuckets;
+			}
+
+
+		public:
+
+			// ctor
+			CStripedHashtable<T, K, S>()
+				:
+				m_mp(NULL),
+				m_stripes(NULL),
+				m_nstripes(0),
+				m_nbuckets_init(0),
+				m_link_offset(gpos::ulong_max),
+				m_key_offset(gpos::ulong_max),
+				m_invalid_key(NULL),
+				m_hashfn(NULL),
+				m_eqfn(NULL)
+			{}
+
+			// dtor
+			// deallocates hashtable internals, does not destroy
+			// client objects
+			~CStripedHashtable<T, K, S>()
+			{
+				Cleanup();
+			}
+
+			// initialization of hashtable
+			void Init
+				(
+				IMemoryPool *mp,
+				ULONG nstripes,
+				ULONG nbuckets,
+				ULONG link_offset,
+				ULONG key_offset,
+				const K *invalid_key,
+				ULONG (*func_hash)(const K&),
+				BOOL (*func_equal)(const K&, const K&)
+				)
+			{
+				GPOS_ASSERT(NULL == m_stripes);
+				GPOS_ASSERT(0 < nstripes);
+				GPOS_ASSERT(0 < nbuckets);
+				GPOS_ASSERT(NULL != invalid_key);
+				GPOS_ASSERT(NULL != func_hash);
+				GPOS_ASSERT(NULL != func_equal);
+
+				m_mp = mp;
+				m_nstripes = nstripes;
+				m_nbuckets_init = nbuckets;
+				m_link_offset = link_offset;
+				m_key_offset = key_offset;
+				m_invalid_key = invalid_key;
+				m_hashfn = func_hash;
+				m_eqfn = func_equal;
+
+				m_stripes = GPOS_NEW_ARRAY(m_mp, SStripe, m_nstripes);
+				for (ULONG i = 0; i < m_nstripes; i++)
+				{
+					m_stripes[i].m_buckets = PlistAllocBuckets(nbuckets);
+					m_stripes[i].m_nbuckets = nbuckets;
+				}
+			}
+
+			// dealloc stripes and reset members
+			void Cleanup()
+			{
+				if (NULL == m_stripes)
+				{
+					return;
+				}
+
+				for (ULONG i = 0; i < m_nstripes; i++)
+				{
+					GPOS_DELETE_ARRAY(m_stripes[i].m_buckets);
+				}
+				GPOS_DELETE_ARRAY(m_stripes);
+				m_stripes = NULL;
+
+				m_nstripes = 0;
+				m_nbuckets_init = 0;
+			}
+
+			// move all entries to the given list in ascending order of their
+			// slots; the list must use the same link as the hashtable
+			void RemoveAll
+				(
+				CList<T> *list
+				)
+			{
+				GPOS_ASSERT(NULL != list);
+
+				const ULONG nslots = m_nstripes * m_nbuckets_init;
+				for (ULONG slot = 0; slot < nslots; slot++)
+				{
+					SStripe &stripe = m_stripes[slot % m_nstripes];
+
+					CAutoSpinlock alock(stripe.m_lock);
+					alock.Lock();
+
+					for (ULONG ul = slot / m_nstripes; ul < stripe.m_nbuckets; ul += m_nbuckets_init)
+					{
+						CList<T> &chain = stripe.m_buckets[ul];
+						while (!chain.IsEmpty())
+						{
+							list->Append(chain.RemoveHead());
+							stripe.m_size--;
+						}
+					}
+				}
+			}
+
+			// return number of entries; not synchronized with concurrent
+			// inserts and removals
+			ULONG_PTR Size() const
+			{
+				ULONG_PTR size = 0;
+				for (ULONG i = 0; i < m_nstripes; i++)
+				{
+					size += m_stripes[i].m_size;
+				}
+
+				return size;
+			}
+
+			// return total number of hash chains; not synchronized with
+			// concurrent growth
+			ULONG_PTR Buckets() const
+			{
+				ULONG_PTR nbuckets = 0;
+				for (ULONG i = 0; i < m_nstripes; i++)
+				{
+					nbuckets += m_stripes[i].m_nbuckets;
+				}
+
+				return nbuckets;
+			}
+
+	}; // class CStripedHashtable
+
+}
+
+#endif // !GPOS_CStripedHashtable_H
+
+// EOF
@@ -0,0 +1,153 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CStripedHashtableAccessByKey.h
+//
+//	@doc:
+//		Accessor for striped hashtable;
+//		The accessor is instantiated with a target key. Throughout its life
+//		time, the accessor holds the spinlock on the target key's stripe --
+//		regardless of whether or not the key exists in the hashtable; this
+//		allows clients to implement test-and-insert/remove functions
+//---------------------------------------------------------------------------
+#ifndef GPOS_CStripedHashtableAccessByKey_H
+#define GPOS_CStripedHashtableAccessByKey_H
+
+#include "gpos/base.h"
+
+#include "gpos/common/CStripedHashtable.h"
+
+
+namespace gpos
+{
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStripedHashtableAccessByKey<T, K, S>
+	//
+	//	@doc:
+	//		Accessor class to encapsulate locking of a hashtable stripe based on
+	//		a passed key
+	//
+	//---------------------------------------------------------------------------
+	template <class T, class K, class S>
+	class CStripedHashtableAccessByKey : public CStackObject
+	{
+
+		private:
+
+			// shorthand for stripes
+			typedef struct CStripedHashtable<T, K, S>::SStripe SStripe;
+
+			// target hashtable
+			CStripedHashtable<T, K, S> &m_ht;
+
+			// target key
+			const K &m_key;
+
+			// hash value of target key, computed once per accessor
+			const ULONG m_hash;
+
+			// stripe to operate on
+			SStripe &m_stripe;
+
+			// no copy ctor
+			CStripedHashtableAccessByKey<T, K, S>
+				(const CStripedHashtableAccessByKey<T, K, S>&);
+
+			// hash chain of target key; chain may change when stripe grows
+			CList<T> &GetBucket() const
+			{
+				return m_ht.GetBucket(m_stripe, m_hash);
+			}
+
+			// finds the first element matching target key starting from
+			// the given element
+			T *NextMatch(T *value) const
+			{
+				T *curr = value;
+
+				while (NULL != curr &&
+					   !m_ht.m_eqfn(m_ht.Key(curr), m_key))
+				{
+					curr = GetBucket().Next(curr);
+				}
+
+				return curr;
+			}
+
+		public:
+
+			// ctor - acquires spinlock on target stripe
+			CStripedHashtableAccessByKey<T, K, S>
+				(CStripedHashtable<T, K, S> &ht, const K &key)
+				:
+				m_ht(ht),
+				m_key(key),
+				m_hash(ht.m_hashfn(key)),
+				m_stripe(ht.GetStripe(m_hash))
+			{
+				GPOS_ASSERT(ht.IsValid(key) && "Invalid key is inaccessible");
+
+				m_stripe.m_lock.Lock();
+			}
+
+			// dtor
+			virtual
+			~CStripedHashtableAccessByKey()
+			{
+				m_stripe.m_lock.Unlock();
+			}
+
+			// finds the first element with a matching key
+			T *Find() const
+			{
+				return NextMatch(GetBucket().First());
+			}
+
+			// finds the next element with a matching key
+			T *Next(T *value) const
+			{
+				GPOS_ASSERT(NULL != value);
+
+				return NextMatch(GetBucket().Next(value));
+			}
+
+			// insert at head of target key's hash chain; grows the stripe
+			// when its load factor is exceeded
+			void Insert(T *value)
+			{
+				GPOS_ASSERT(NULL != value);
+				GPOS_ASSERT(m_ht.m_eqfn(m_ht.Key(value), m_key));
+
+				if (m_stripe.m_size >= GPOS_STRIPED_HT_MAX_LOAD * m_stripe.m_nbuckets)
+				{
+					m_ht.Grow(m_stripe);
+				}
+
+				GetBucket().Prepend(value);
+				m_stripe.m_size++;
+			}
+
+			// unlinks element
+			void Remove(T *value)
+			{
+				GPOS_ASSERT(0 < m_stripe.m_size);
+
+				GPOS_ASSERT(NULL != value);
+				GPOS_ASSERT(m_ht.m_eqfn(m_ht.Key(value), m_key));
+
+				// is-list-member check is done in CList
+				GetBucket().Remove(value);
+				m_stripe.m_size--;
+			}
+
+	}; // class CStripedHashtableAccessByKey
+
+}
+
+#endif // !GPOS_CStripedHashtableAccessByKey_H
+
+// EOF
@@ -106,6 +106,12 @@ namespace gpos
 		// create a unique temporary directory
 		void CreateTempDir(CHAR *dir_path);
 
+		// map file contents into memory for reading
+		const void *MapFile(INT file_descriptor, ULLONG size);
+
+		// unmap file contents mapped by MapFile
+		void UnmapFile(const void *addr, ULLONG size);
+
 #ifdef GPOS_FPSIMULATOR
 		// inject I/O error for functions whose returned value type is INT
 		BOOL SimulateIOError(INT *return_value, INT error_no, const CHAR *file, ULONG line_num);
@@ -47,6 +47,9 @@
 // eligible to delete
 #define EXPECTED_REF_COUNT_FOR_DELETE 1
 
+// multiplier for mapping hash values to shards (golden ratio * 2^32)
+#define CACHE_SHARD_HASH_MULTIPLIER 2654435769U
+
 using namespace gpos;
 
 namespace gpos
@@ -73,6 +76,9 @@ namespace gpos
 	//		Cache can only be accessed through the CCacheAccessor friend class.
 	//		The current implementation has a fixed gclock based eviction policy.
 	//
+	//		Cache may be partitioned into shards by the hash of the key; each
+	//		shard evicts independently within its slice of the cache quota.
+	//
 	//---------------------------------------------------------------------------
 	template <class T, class K>
 	class CCache
@@ -83,6 +89,7 @@ namespace gpos
 			// type definition of key hashing and equality functions
 			typedef ULONG (*HashFuncPtr)(const K&);
 			typedef BOOL (*EqualFuncPtr)(const K&, const K&);
+			typedef void (*VisitFuncPtr)(T, void*);
 
 		private:
 
@@ -98,15 +105,57 @@ namespace gpos
 			typedef CSyncHashtableAccessByIter<CCacheHashTableEntry, K, CSpinlockCache>
 					CCacheHashtableIterAccessor;
 
+			//---------------------------------------------------------------------------
+			//	@struct:
+			//		SShard
+			//
+			//	@doc:
+			//		Independent partition of the cache; each shard has its own
+			//		hashtable, slice of the cache quota and gclock hand, so that
+			//		eviction in one shard does not block insertions into others
+			//
+			//---------------------------------------------------------------------------
+			struct SShard
+			{
+				// total size of the shard in bytes
+				volatile ULLONG m_cache_size;
+
+				// quota of the shard in bytes; 0 means unlimited quota
+				ULLONG m_cache_quota;
+
+				// number of times shard entries were evicted
+				ULLONG m_eviction_counter;
+
+				// atomic lock for eviction; only one thread can execute eviction process at a time
+				volatile ULONG m_eviction_lock;
+
+				// if the gclock hand was already advanced and therefore can serve the next entry
+				BOOL m_clock_hand_advanced;
+
+				// synchronized hash table; used to store and lookup entries
+				CCacheHashtable m_hash_table;
+
+				// the clock hand for gclock eviction policy
+				CCacheHashtableIter *m_clock_hand;
+
+				// ctor
+				SShard()
+					:
+					m_cache_size(0),
+					m_cache_quota(UNLIMITED_CACHE_QUOTA),
+					m_eviction_counter(0),
+					m_eviction_lock(0),
+					m_clock_hand_advanced(false),
+					m_clock_hand(NULL)
+				{}
+			};
+
 			// memory pool for allocating hashtable and cache entries
 			IMemoryPool *m_mp;
 
 			// true if cache does not allow multiple objects with the same key
 			BOOL m_unique;
 
-			// total size of the cache in bytes
-			ULLONG m_cache_size;
-
 			// quota of the cache in bytes; 0 means unlimited quota
 			ULLONG m_cache_quota;
 
@@ -116,38 +165,61 @@ namespace gpos
 			// what percent of the cache size to evict
 			float m_eviction_factor;
 
-			// number of times cache entries were evicted
-			ULLONG m_eviction_counter;
-
-			// atomic lock for eviction; only one thread can execute eviction process at a time
-			volatile ULONG m_eviction_lock;
-
-			// if the gclock hand was already advanced and therefore can serve the next entry
-			BOOL m_clock_hand_advanced;
-
 			// a pointer to key hashing function
 			HashFuncPtr m_hash_func;
 
 			// a pointer to key equality function
 			EqualFuncPtr m_equal_func;
 
-			// synchronized hash table; used to store and lookup entries
-			CCacheHashtable m_hash_table;
+			// number of shards
+			ULONG m_num_shards;
 
-			// the clock hand for gclock eviction policy
-			CCacheHashtableIter *m_clock_hand;
+			// cache shards
+			SShard *m_shards;
+
+			// returns the shard holding the given key
+			SShard &GetShard(const K &key) const
+			{
+				if (1 == m_num_shards)
+				{
+					return m_shards[0];
+				}
+
+				// pick shard from the high bits of a multiplicative hash, so that
+				// entries of a shard spread over all buckets of its hashtable
+				ULONG hash = m_hash_func(key) * CACHE_SHARD_HASH_MULTIPLIER;
+				return m_shards[(ULONG) (((ULLONG) hash * m_num_shards) >> 32)];
+			}
+
+			// sets the quota of each shard to its slice of the cache quota
+			void SetShardQuotas()
+			{
+				ULLONG shard_quota = m_cache_quota / m_num_shards;
+				if (0 != m_cache_quota && 0 == shard_quota)
+				{
+					// a zero quota would make a shard unlimited
+					shard_quota = 1;
+				}
+
+				for (ULONG ul = 0; ul < m_num_shards; ul++)
+				{
+					m_shards[ul].m_cache_quota = shard_quota;
+				}
+			}
 
 			// inserts a new object
 			CCacheHashTableEntry *InsertEntry(CCacheHashTableEntry *entry)
 			{
 				GPOS_ASSERT(NULL != entry);
 
-				if (0 != m_cache_quota && m_cache_size > m_cache_quota)
+				SShard &shard = GetShard(entry->Key());
+
+				if (0 != shard.m_cache_quota && shard.m_cache_size > shard.m_cache_quota)
 				{
-					EvictEntries();
+					EvictEntries(shard);
 				}
 
-				CCacheHashtableAccessor acc(m_hash_table, entry->Key());
+				CCacheHashtableAccessor acc(shard.m_hash_table, entry->Key());
 
 				// if we allow duplicates, insertion can be directly made;
 				// if we do not allow duplicates, we need to check first
@@ -157,7 +229,7 @@ namespace gpos
 					(m_unique && NULL == (found = acc.Find())))
 				{
 					acc.Insert(entry);
-					ExchangeAddUllongWithUllong((volatile ULLONG *)&m_cache_size, entry->Pmp()->TotalAllocatedSize());
+					ExchangeAddUllongWithUllong(&shard.m_cache_size, entry->Pmp()->TotalAllocatedSize());
 				}
 				else
 				{
@@ -173,7 +245,7 @@ namespace gpos
 			// returns the first object matching the given key
 			CCacheHashTableEntry *Get(const K key)
 			{
-				CCacheHashtableAccessor acc(m_hash_table, key);
+				CCacheHashtableAccessor acc(GetShard(key).m_hash_table, key);
 
 				// look for the first unmarked entry matching the given key
 				CCacheHashTableEntry *entry = acc.Find();
@@ -206,7 +278,7 @@ namespace gpos
 
 				// scope for hashtable accessor
 				{
-					CCacheHashtableAccessor acc(m_hash_table, entry->Key());
+					CCacheHashtableAccessor acc(GetShard(entry->Key()).m_hash_table, entry->Key());
 					entry->DecRefCount();
 
 					if (EXPECTED_REF_COUNT_FOR_DELETE == entry->RefCount() && entry->IsMarkedForDeletion())
@@ -231,7 +303,7 @@ namespace gpos
 
 				CCacheHashTableEntry *current = entry;
 				K key = current->Key();
-				CCacheHashtableAccessor acc(m_hash_table, key);
+				CCacheHashtableAccessor acc(GetShard(key).m_hash_table, key);
 
 				// move forward until we find unmarked entry with the same key
 				CCacheHashTableEntry *next = acc.Next(current);
@@ -249,18 +321,18 @@ namespace gpos
 				return next;
 			}
 
-			// Evict entries until the cache size is within the cache quota or until
-			// the cache does not have any more evictable entries
-			void EvictEntries()
+			// Evict entries of a shard until the shard size is within the shard quota
+			// or until the shard does not have any more evictable entries
+			void EvictEntries(SShard &shard)
 			{
-				GPOS_ASSERT(0 != m_cache_quota || "Cannot evict from an unlimited sized cache");
+				GPOS_ASSERT(0 != shard.m_cache_quota || "Cannot evict from an unlimited sized cache");
 
-				if (CompareSwap(&m_eviction_lock, 0, 1))
+				if (CompareSwap(&shard.m_eviction_lock, 0, 1))
 				{
-					if (m_cache_size > m_cache_quota)
+					if (shard.m_cache_size > shard.m_cache_quota)
 					{
-						double to_free = static_cast<double>(static_cast<double>(m_cache_size) -
-								static_cast<double>(m_cache_quota) * (1.0 - m_eviction_factor));
+						double to_free = static_cast<double>(static_cast<double>(shard.m_cache_size) -
+								static_cast<double>(shard.m_cache_quota) * (1.0 - m_eviction_factor));
 						GPOS_ASSERT(0 < to_free);
 
 						ULLONG num_to_free = static_cast<ULLONG>(to_free);
@@ -271,37 +343,44 @@ namespace gpos
 						// we may end up circling 1 less time than the retry count
 						for (ULONG retry_count = 0; retry_count < m_gclock_init_counter + 1; retry_count++)
 						{
-							total_freed = EvictEntriesOnePass(total_freed, num_to_free);
+							total_freed = EvictEntriesOnePass(shard, total_freed, num_to_free);
 
 							if (total_freed >= num_to_free)
 							{
 								// successfully freed up enough. The final action must have been a valid eviction
-								GPOS_ASSERT(m_clock_hand_advanced);
+								GPOS_ASSERT(shard.m_clock_hand_advanced);
 								// no need to retry
 								break;
 							}
 
 							// exhausted the iterator, so rewind it
-							m_clock_hand->Rewind();
+							shard.m_clock_hand->Rewind();
 						}
 
 						if (0 < total_freed)
 						{
-							++m_eviction_counter;
+							++shard.m_eviction_counter;
 						}
 					}
 
 					// release the lock
-					m_eviction_lock = 0;
+					shard.m_eviction_lock = 0;
 				}
 			}
 
 			// cleans up when cache is destroyed
 			void Cleanup()
 			{
-				m_hash_table.DestroyEntries(DestroyCacheEntryWithRefCountTest);
-				GPOS_DELETE(m_clock_hand);
-				m_clock_hand = NULL;
+				for (ULONG ul = 0; ul < m_num_shards; ul++)
+				{
+					SShard &shard = m_shards[ul];
+					shard.m_hash_table.DestroyEntries(DestroyCacheEntryWithRefCountTest);
+					GPOS_DELETE(shard.m_clock_hand);
+					shard.m_clock_hand = NULL;
+				}
+
+				GPOS_DELETE_ARRAY(m_shards);
+				m_shards = NULL;
 			}
 
 			static
@@ -328,18 +407,18 @@ namespace gpos
 				CMemoryPoolManager::GetMemoryPoolMgr()->Destroy(mp);
 			}
 
-			// evict entries by making one pass through the hash table buckets
-			ULLONG EvictEntriesOnePass(ULLONG total_freed, ULLONG num_to_free)
+			// evict entries by making one pass through the shard's hash table buckets
+			ULLONG EvictEntriesOnePass(SShard &shard, ULLONG total_freed, ULLONG num_to_free)
 			{
 				while ((total_freed < num_to_free)
-					&& (m_clock_hand_advanced || m_clock_hand->Advance()))
+					&& (shard.m_clock_hand_advanced || shard.m_clock_hand->Advance()))
 				{
-					m_clock_hand_advanced = false;
+					shard.m_clock_hand_advanced = false;
 					CCacheHashTableEntry *entry = NULL;
 					BOOL deleted = false;
 					// Scope for CCacheHashtableIterAccessor
 					{
-						CCacheHashtableIterAccessor acc(*m_clock_hand);
+						CCacheHashtableIterAccessor acc(*shard.m_clock_hand);
 
 						if (NULL != (entry = acc.Value()))
 						{
@@ -357,11 +436,10 @@ namespace gpos
 									deleted = true;
 
 									// successfully removing an entry automatically advances the iterator, so don't call Advance()
-									m_clock_hand_advanced = true;
+									shard.m_clock_hand_advanced = true;
 
 									ULLONG num_freed = entry->Pmp()->TotalAllocatedSize();
-									ExchangeAddUllongWithUllong((volatile ULLONG *) &m_cache_size,
-											-num_freed);
+									ExchangeAddUllongWithUllong(&shard.m_cache_size, -num_freed);
 									total_freed += num_freed;
 								}
 							}
@@ -392,39 +470,51 @@ namespace gpos
 				ULLONG cache_quota,
 				ULONG g_clock_init_counter,
 				HashFuncPtr hash_func,
-				EqualFuncPtr equal_func
+				EqualFuncPtr equal_func,
+				ULONG num_shards = 1
 				)
 			:
 			m_mp(mp),
 			m_unique(unique),
-			m_cache_size(0),
 			m_cache_quota(cache_quota),
 			m_gclock_init_counter(g_clock_init_counter),
 			m_eviction_factor((float)0.1),
-			m_eviction_counter(0),
-			m_eviction_lock(0),
-			m_clock_hand_advanced(false),
 			m_hash_func(hash_func),
-			m_equal_func(equal_func)
+			m_equal_func(equal_func),
+			m_num_shards(num_shards),
+			m_shards(NULL)
 			{
 				GPOS_ASSERT(NULL != m_mp &&
 						    "Cache memory pool could not be initialized");
 
 				GPOS_ASSERT(0 != g_clock_init_counter);
+				GPOS_ASSERT(0 < num_shards);
+
+				m_shards = GPOS_NEW_ARRAY(mp, SShard, m_num_shards);
+
+				// shards split the buckets, which keeps clock hand passes short
+				const ULONG num_buckets = (CACHE_HT_NUM_OF_BUCKETS + m_num_shards - 1) / m_num_shards;
 
-				// initialize hashtable
-				m_hash_table.Init
-					(
-					m_mp,
-					CACHE_HT_NUM_OF_BUCKETS,
-					GPOS_OFFSET(CCacheHashTableEntry, m_link_hash),
-					GPOS_OFFSET(CCacheHashTableEntry, m_key),
-					(&CCacheHashTableEntry::m_invalid_key),
-					m_hash_func,
-					m_equal_func
-					);
-
-				m_clock_hand = GPOS_NEW(mp) CCacheHashtableIter(m_hash_table);
+				for (ULONG ul = 0; ul < m_num_shards; ul++)
+				{
+					SShard &shard = m_shards[ul];
+
+					// initialize hashtable
+					shard.m_hash_table.Init
+						(
+						m_mp,
+						num_buckets,
+						GPOS_OFFSET(CCacheHashTableEntry, m_link_hash),
+						GPOS_OFFSET(CCacheHashTableEntry, m_key),
+						(&CCacheHashTableEntry::m_invalid_key),
+						m_hash_func,
+						m_equal_func
+						);
+
+					shard.m_clock_hand = GPOS_NEW(mp) CCacheHashtableIter(shard.m_hash_table);
+				}
+
+				SetShardQuotas();
 			}
 
 			// dtor
@@ -439,16 +529,34 @@ namespace gpos
 				return m_unique;
 			}
 
+			// return number of cache shards
+			ULONG NumShards() const
+			{
+				return m_num_shards;
+			}
+
 			// return number of cache entries
 			ULONG_PTR Size() const
 			{
-				return m_hash_table.Size();
+				ULONG_PTR size = 0;
+				for (ULONG ul = 0; ul < m_num_shards; ul++)
+				{
+					size += m_shards[ul].m_hash_table.Size();
+				}
+
+				return size;
 			}
 
 			// return total allocated size in bytes
 			ULLONG TotalAllocatedSize()
 			{
-				return m_cache_size;
+				ULLONG cache_size = 0;
+				for (ULONG ul = 0; ul < m_num_shards; ul++)
+				{
+					cache_size += m_shards[ul].m_cache_size;
+				}
+
+				return cache_size;
 			}
 
 			// return memory quota of the cache
@@ -457,20 +565,31 @@ namespace gpos
 				return m_cache_quota;
 			}
 
-			// return number of times this cache underwent eviction
+			// return number of times cache shards underwent eviction
 			ULLONG GetEvictionCounter()
 			{
-				return m_eviction_counter;
+				ULLONG eviction_counter = 0;
+				for (ULONG ul = 0; ul < m_num_shards; ul++)
+				{
+					eviction_counter += m_shards[ul].m_eviction_counter;
+				}
+
+				return eviction_counter;
 			}
 
 			// sets the cache quota
 			void SetCacheQuota(ULLONG new_quota)
 			{
 				m_cache_quota = new_quota;
+				SetShardQuotas();
 
-				if (0 != m_cache_quota && m_cache_size > m_cache_quota)
+				for (ULONG ul = 0; ul < m_num_shards; ul++)
 				{
-					EvictEntries();
+					SShard &shard = m_shards[ul];
+					if (0 != shard.m_cache_quota && shard.m_cache_size > shard.m_cache_quota)
+					{
+						EvictEntries(shard);
+					}
 				}
 			}
 
@@ -480,6 +599,28 @@ namespace gpos
 				return m_eviction_factor;
 			}
 
+			// call visitor function on the values of all live entries; the
+			// visitor runs while holding the entry's bucket lock and must not
+			// block or access the cache
+			void Visit(VisitFuncPtr visit_func, void *context)
+			{
+				GPOS_ASSERT(NULL != visit_func);
+
+				for (ULONG ul = 0; ul < m_num_shards; ul++)
+				{
+					CCacheHashtableIter iter(m_shards[ul].m_hash_table);
+					while (iter.Advance())
+					{
+						CCacheHashtableIterAccessor acc(iter);
+						CCacheHashTableEntry *entry = acc.Value();
+						if (NULL != entry && !entry->IsMarkedForDeletion())
+						{
+							visit_func(entry->Val(), context);
+						}
+					}
+				}
+			}
+
     }; //  CCache
 
 	// invalid key
@@ -25,6 +25,9 @@
 // default initial value of the gclock counter during insertion of an entry
 #define CCACHE_GCLOCK_INIT_COUNTER 3
 
+// default number of shards of a sharded cache
+#define CCACHE_NUM_SHARDS 16
+
 using namespace gpos;
 
 namespace gpos
@@ -110,6 +113,38 @@ namespace gpos
 
 			}
 
+			// create a cache instance partitioned into independently evicting
+			// shards, for caches shared by many concurrent clients
+			template <class T, class K>
+			static
+			CCache<T, K> *CreateShardedCache
+				(
+				BOOL unique,
+				ULLONG cache_quota,
+				typename CCache<T, K>::HashFuncPtr hash_func,
+				typename CCache<T, K>::EqualFuncPtr equal_func,
+				ULONG num_shards = CCACHE_NUM_SHARDS
+				)
+			{
+				GPOS_ASSERT(NULL != GetFactory() &&
+						    "Cache factory has not been initialized");
+				GPOS_ASSERT(0 < num_shards);
+
+				IMemoryPool *mp = GetFactory()->Pmp();
+				CCache<T, K> *cache = GPOS_NEW(mp) CCache<T, K>
+							(
+							mp,
+							unique,
+							cache_quota,
+							CCACHE_GCLOCK_INIT_COUNTER,
+							hash_func,
+							equal_func,
+							num_shards
+							);
+
+				return cache;
+			}
+
 			IMemoryPool *Pmp() const;
 
 	}; // CCacheFactory
@@ -0,0 +1,212 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CMemoryPoolArena.h
+//
+//	@doc:
+//		Memory pool that hands out memory from per-thread chunks by bumping
+//		an offset; individual allocations are never released.
+//
+//	@owner:
+//
+//	@test:
+//
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMemoryPoolArena_H
+#define GPOS_CMemoryPoolArena_H
+
+#include "gpos/assert.h"
+#include "gpos/types.h"
+#include "gpos/utils.h"
+#include "gpos/common/CList.h"
+#include "gpos/memory/CMemoryPool.h"
+#include "gpos/sync/CAutoSpinlock.h"
+#include "gpos/sync/CSpinlock.h"
+
+// number of allocation slots; threads are mapped to slots by their id
+#define GPOS_MEM_ARENA_SLOTS	(64)
+
+
+namespace gpos
+{
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CMemoryPoolArena
+	//
+	//	@doc:
+	//
+	//		Region allocator for objects that share the lifetime of the pool;
+	//		memory is carved out of chunks obtained from the underlying pool.
+	//
+	//		Each thread allocates from the current chunk of its own slot, so
+	//		concurrent allocations from different threads do not contend on a
+	//		common lock; a slot's lock is only contended when two threads hash
+	//		to the same slot. Requests that exceed a fraction of the chunk size
+	//		get a dedicated chunk.
+	//
+	//		Free is a no-op; all chunks are returned to the underlying pool
+	//		when the pool is torn down.
+	//
+	//---------------------------------------------------------------------------
+	class CMemoryPoolArena : public CMemoryPool
+	{
+		private:
+
+			// chunk descriptor, located at the beginning of each chunk
+			struct SChunk
+			{
+				// total size
+				ULONG m_total_size;
+
+				// used size
+				ULONG m_used_size;
+
+				// link for chunk list
+				SLink m_link;
+
+				// init
+				void Init
+					(
+					ULONG total
+					)
+				{
+					m_total_size = total;
+					m_used_size = GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunk);
+					m_link.m_next = NULL;
+					m_link.m_prev = NULL;
+				}
+
+				// check if there is enough space for allocation request
+				BOOL CanFit
+					(
+					ULONG alloc
+					)
+					const
+				{
+					return (m_total_size - m_used_size >= alloc);
+				}
+
+				// reserve space for allocation request
+				void *Reserve
+					(
+					ULONG alloc
+					)
+				{
+					GPOS_ASSERT(CanFit(alloc));
+
+					void *ptr = GPOS_MEM_OFFSET_POS(this, m_used_size);
+					m_used_size += alloc;
+
+					return ptr;
+				}
+			};
+
+			// allocation slot
+			struct SSlot
+			{
+				// spinlock to protect allocations inside the current chunk
+				CSpinlockOS m_lock;
+
+				// chunk currently allocated from
+				SChunk *m_chunk;
+			};
+
+			// allocation slots
+			SSlot m_slots[GPOS_MEM_ARENA_SLOTS];
+
+			// size of memory reserved from the underlying pool
+			volatile ULLONG m_reserved;
+
+			// max memory to allow in the pool;
+			// if equal to ULLONG, checks for exceeding max memory are bypassed
+			const ULLONG m_capacity;
+
+			// default chunk size
+			const ULONG m_chunk_size;
+
+			// list of allocated chunks
+			CList<SChunk> m_chunk_list;
+
+			// spinlock to protect chunk list
+			CSpinlockOS m_lock;
+
+			// find slot of the calling thread
+			SSlot &GetSlot();
+
+			// allocate chunk from underlying pool and keep track of it
+			SChunk *New(ULONG alloc);
+
+#ifdef GPOS_DEBUG
+			// check if a particular allocation is sound for this memory pool
+			void CheckAllocation(void *ptr);
+#endif // GPOS_DEBUG
+
+			// private copy ctor
+			CMemoryPoolArena(CMemoryPoolArena &);
+
+		public:
+
+			// ctor
+			CMemoryPoolArena
+				(
+				IMemoryPool *mp,
+				ULLONG capacity,
+				BOOL thread_safe,
+				BOOL owns_underlying_memory_pool
+				);
+
+			// dtor
+			virtual
+			~CMemoryPoolArena();
+
+			// allocate memory
+			virtual
+			void *Allocate
+				(
+				const ULONG bytes,
+				const CHAR *file,
+				const ULONG line
+				);
+
+			// free memory - memory is released when the memory pool is torn down
+			virtual
+			void Free
+				(
+#ifdef GPOS_DEBUG
+				void *ptr
+#else
+				void *
+#endif // GPOS_DEBUG
+				)
+			{
+#ifdef GPOS_DEBUG
+				CheckAllocation(ptr);
+#endif // GPOS_DEBUG
+			}
+
+			// return all chunks to the underlying pool and tear it down
+			virtual
+			void TearDown();
+
+			// check if the pool stores a pointer to itself at the end of
+			// the header of each allocated object;
+			virtual
+			BOOL StoresPoolPointer() const
+			{
+				return true;
+			}
+
+			// return total allocated size
+			virtual
+			ULLONG TotalAllocatedSize() const
+			{
+				return m_reserved;
+			}
+	};
+}
+
+#endif // !GPOS_CMemoryPoolArena_H
+
+// EOF
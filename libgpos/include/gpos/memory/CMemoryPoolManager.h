@@ -42,7 +42,8 @@ namespace gpos
 			enum AllocType
 			{
 				EatTracker,
-				EatStack
+				EatStack,
+				EatArena
 			};
 
 		private:
@@ -122,6 +122,34 @@ namespace gpos
 				m_live_obj_total_size -= total_data_size;
 			}
 
+			// record a batch of successful allocations
+			void RecordAllocations
+				(
+				ULLONG num_allocations,
+				ULLONG user_data_size,
+				ULLONG total_data_size
+				)
+			{
+				m_num_successful_allocations += num_allocations;
+				m_num_live_obj += num_allocations;
+				m_live_obj_user_size += user_data_size;
+				m_live_obj_total_size += total_data_size;
+			}
+
+			// record a batch of successful free calls
+			void RecordFrees
+				(
+				ULLONG num_free,
+				ULLONG user_data_size,
+				ULLONG total_data_size
+				)
+			{
+				m_num_free += num_free;
+				m_num_live_obj -= num_free;
+				m_live_obj_user_size -= user_data_size;
+				m_live_obj_total_size -= total_data_size;
+			}
+
 			// record a failed allocation attempt
 			void RecordFailedAllocation()
 			{
@@ -26,6 +26,15 @@
 #include "gpos/sync/CAutoSpinlock.h"
 #include "gpos/sync/CSpinlock.h"
 
+// size classes served from magazines; classes are spaced by the alignment
+// size so that blocks fit aligned requests exactly, up to
+// GPOS_MEM_MAGAZINE_MAX_SIZE bytes
+#define GPOS_MEM_MAGAZINE_MAX_SIZE	(512)
+#define GPOS_MEM_MAGAZINE_CLASSES	(GPOS_MEM_MAGAZINE_MAX_SIZE / GPOS_MEM_ARCH)
+
+// number of magazine slots; threads are mapped to slots by their id
+#define GPOS_MEM_MAGAZINE_SLOTS		(64)
+
 namespace gpos
 {
 	// prototypes
@@ -64,13 +73,138 @@ namespace gpos
 				CStackDescriptor m_stack_desc;
 #endif // GPOS_DEBUG
 
-				// link for allocation list
+				// flag indicating that block is owned by a magazine
+				BOOL m_magazine;
+
+				// link for allocation list; links free blocks in a magazine
 				SLink m_link;
 			};
 
+			//---------------------------------------------------------------------------
+			//	@struct:
+			//		SMagazine
+			//
+			//	@doc:
+			//		Stack of free blocks of one size class
+			//
+			//---------------------------------------------------------------------------
+			struct SMagazine
+			{
+				// top of stack
+				SAllocHeader *m_top;
+
+				// number of blocks
+				ULONG m_size;
+
+				// ctor
+				SMagazine()
+					:
+					m_top(NULL),
+					m_size(0)
+				{}
+
+				// push block
+				void Push
+					(
+					SAllocHeader *header
+					)
+				{
+					header->m_link.m_next = m_top;
+					m_top = header;
+					m_size++;
+				}
+
+				// pop block
+				SAllocHeader *Pop()
+				{
+					GPOS_ASSERT(NULL != m_top);
+
+					SAllocHeader *header = m_top;
+					m_top = static_cast<SAllocHeader*>(header->m_link.m_next);
+					m_size--;
+
+					return header;
+				}
+			};
+
+			//---------------------------------------------------------------------------
+			//	@struct:
+			//		SMagazineSlot
+			//
+			//	@doc:
+			//		Magazines of the threads mapped to a slot and their pending
+			//		statistics, which are periodically aggregated into the pool's
+			//		statistics
+			//
+			//---------------------------------------------------------------------------
+			struct SMagazineSlot
+			{
+				// lock for synchronization
+				CSpinlockOS m_lock;
+
+				// free blocks per size class
+				SMagazine m_magazines[GPOS_MEM_MAGAZINE_CLASSES];
+
+				// number of allocations and frees since last aggregation
+				ULONG m_num_ops;
+
+				// pending allocations
+				ULLONG m_num_allocations;
+				ULLONG m_alloc_user_size;
+				ULLONG m_alloc_total_size;
+
+				// pending frees
+				ULLONG m_num_free;
+				ULLONG m_free_user_size;
+				ULLONG m_free_total_size;
+
+				// ctor
+				SMagazineSlot()
+					:
+					m_num_ops(0),
+					m_num_allocations(0),
+					m_alloc_user_size(0),
+					m_alloc_total_size(0),
+					m_num_free(0),
+					m_free_user_size(0),
+					m_free_total_size(0)
+				{}
+			};
+
+			//---------------------------------------------------------------------------
+			//	@struct:
+			//		SMagazineCache
+			//
+			//	@doc:
+			//		Per-thread magazines of small blocks; blocks are carved from
+			//		chunks of the underlying pool and move between magazines and
+			//		a shared depot in batches
+			//
+			//---------------------------------------------------------------------------
+			struct SMagazineCache
+			{
+				// magazine slots
+				SMagazineSlot m_slots[GPOS_MEM_MAGAZINE_SLOTS];
+
+				// shared free blocks per size class, protected by pool's lock
+				SMagazine m_depot[GPOS_MEM_MAGAZINE_CLASSES];
+
+				// chunks allocated from underlying pool, protected by pool's lock
+				CList<SLink> m_chunks;
+
+				// ctor
+				SMagazineCache()
+				{
+					m_chunks.Init(0 /*offset*/);
+				}
+			};
+
 			// lock for synchronization
 			CSpinlockOS m_lock;
 
+			// magazines, created once the pool has made enough allocations
+			SMagazineCache * volatile m_magazine_cache;
+
 			// statistics
 			CMemoryPoolStatistics m_memory_pool_statistics;
 
@@ -94,6 +228,37 @@ namespace gpos
 			// revert memory reservation
 			void Unreserve(CAutoSpinlock &as, ULONG alloc, BOOL mem_available);
 
+			// check if allocation of given size is served from magazines
+			BOOL FUseMagazine
+				(
+				ULONG bytes
+				)
+				const
+			{
+				return NULL != m_magazine_cache && 0 < bytes && GPOS_MEM_MAGAZINE_MAX_SIZE >= bytes;
+			}
+
+			// create magazines once pool has made enough allocations
+			void CreateMagazines();
+
+			// find magazine slot of the calling thread
+			SMagazineSlot &GetMagazineSlot();
+
+			// allocate from magazine of the calling thread
+			void *AllocateFromMagazine(ULONG bytes, const CHAR *file, ULONG line);
+
+			// return block to magazine of the calling thread
+			void FreeToMagazine(SAllocHeader *header);
+
+			// refill a magazine from the depot or from a new chunk
+			BOOL RefillMagazine(SMagazine &magazine, ULONG size_class);
+
+			// aggregate pending statistics of a slot
+			void AggregateStatistics(SMagazineSlot &slot);
+
+			// return magazine chunks to the underlying pool
+			void ReleaseMagazines();
+
 			// acquire spinlock if pool is thread-safe
 			void SLock(CAutoSpinlock &as)
 			{
@@ -159,10 +324,7 @@ namespace gpos
 
 			// return total allocated size
 			virtual
-			ULLONG TotalAllocatedSize() const
-			{
-				return m_memory_pool_statistics.TotalAllocatedSize();
-			}
+			ULLONG TotalAllocatedSize() const;
 
 #ifdef GPOS_DEBUG
 
@@ -48,6 +48,9 @@ namespace gpos
 		// print exception on raise to stderr
 		EtracePrintExceptionOnRaise = 104,
 
+		// disable size-class magazines in tracker memory pools
+		EtraceDisableMemoryMagazines = 105,
+
 		EtraceSentinel
 	};
 }
@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CStripedHashtableTest.h
+//
+//	@doc:
+//      Test for CStripedHashtable
+//---------------------------------------------------------------------------
+#ifndef GPOS_CStripedHashtableTest_H
+#define GPOS_CStripedHashtableTest_H
+
+#include "gpos/base.h"
+
+#include "gpos/common/CStripedHashtable.h"
+#include "gpos/common/CStripedHashtableAccessByKey.h"
+
+namespace gpos
+{
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStripedHashtableTest
+	//
+	//	@doc:
+	//		Unittests for striped hashtable
+	//
+	//---------------------------------------------------------------------------
+	class CStripedHashtableTest
+	{
+
+		// prototypes
+		struct SElem;
+
+		private:
+
+			// types used by testing functions
+			typedef CStripedHashtable<SElem, ULONG, CSpinlockDummy>
+				SElemHashtable;
+
+			typedef CStripedHashtableAccessByKey<SElem, ULONG, CSpinlockDummy>
+				SElemHashtableAccessor;
+
+			//---------------------------------------------------------------------------
+			//	@class:
+			//		SElem
+			//
+			//	@doc:
+			//		Local class for hashtable tests
+			//
+			//---------------------------------------------------------------------------
+			struct SElem
+			{
+				// generic link
+				SLink m_link;
+
+				// hash key
+				ULONG m_ulKey;
+
+				// invalid key
+				static
+				const ULONG m_ulInvalid;
+
+				// simple hash function
+				static ULONG HashValue
+					(
+					const ULONG &ul
+					)
+				{
+					return ul;
+				}
+
+				// key equality function for hashtable
+				static
+				BOOL FEqualKeys
+					(
+					const ULONG &ulkey,
+					const ULONG &ulkeyOther
+					)
+				{
+					return ulkey == ulkeyOther;
+				}
+
+			}; // struct SElem
+
+			//---------------------------------------------------------------------------
+			//	@class:
+			//		SElemTest
+			//
+			//	@doc:
+			//		Local class used for passing arguments to concurrent tasks
+			//
+			//---------------------------------------------------------------------------
+			struct SElemTest
+			{
+				// hash table to operate on
+				SElemHashtable *m_psht;
+
+				// array of elements, one slice per task
+				SElem *m_rgelem;
+
+				// number of elements per task
+				ULONG m_ulElems;
+
+				// number of distinct keys shared by all tasks
+				ULONG m_ulKeys;
+
+			}; // struct SElemTest
+
+			// inserts a slice of elements unless an element with the same key exists
+			static void *PvUnittest_Inserter(void *);
+
+		public:
+
+			// actual unittests
+			static GPOS_RESULT EresUnittest();
+			static GPOS_RESULT EresUnittest_Basics();
+			static GPOS_RESULT EresUnittest_Grow();
+			static GPOS_RESULT EresUnittest_Concurrency();
+
+	}; // class CStripedHashtableTest
+}
+
+#endif // !GPOS_CStripedHashtableTest_H
+
+// EOF
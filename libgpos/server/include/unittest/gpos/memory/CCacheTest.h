@@ -92,6 +92,22 @@ namespace gpos
 
 			static void* PvLookupTask(void *);
 
+			// arguments of benchmark task
+			struct SBenchmarkArgs
+			{
+				// cache to operate on
+				CCache<SSimpleObject*, ULONG*> *m_pcache;
+
+				// seed of random key generator
+				ULONG m_ulSeed;
+			};
+
+			// task that looks up random keys and inserts missing ones
+			static void* PvBenchmarkTask(void *);
+
+			// run benchmark tasks against a cache, return elapsed time in ms
+			static ULONG UlBenchmark(CCache<SSimpleObject*, ULONG*> *pcache);
+
 			// inserts one SSimpleObject with key and value set to ulKey
 			static ULLONG InsertOneElement(CCache<SSimpleObject*, ULONG*> *pCache, ULONG ulKey);
 
@@ -199,6 +215,7 @@ namespace gpos
 			static GPOS_RESULT EresUnittest_Iteration();
 			static GPOS_RESULT EresUnittest_IterativeDeletion();
 			static GPOS_RESULT EresUnittest_ConcurrentAccess();
+			static GPOS_RESULT EresUnittest_ShardedBenchmark();
 
 
 	}; // class CCacheTest
@@ -48,9 +48,16 @@ namespace gpos
 			static void *AllocateSerial(void *pv);
 			static void *AllocateRepeated(void *pv);
 			static void *AllocateStress(void *pv);
+			static void *AllocateBenchmark(void *pv);
 			static void Allocate(IMemoryPool *mp, ULONG count);
 			static void AllocateRandom(IMemoryPool *mp);
 			static ULONG Size(ULONG offset);
+			static ULONG UlBenchmark
+				(
+				CMemoryPoolManager::AllocType eat,
+				ULONG ulTasks,
+				ULLONG *pullFootprint
+				);
 
 		public:
 
@@ -62,6 +69,9 @@ namespace gpos
 			static GPOS_RESULT EresUnittest_TestTracker();
 			static GPOS_RESULT EresUnittest_TestSlab();
 			static GPOS_RESULT EresUnittest_TestStack();
+			static GPOS_RESULT EresUnittest_TestArena();
+			static GPOS_RESULT EresUnittest_ArenaBenchmark();
+			static GPOS_RESULT EresUnittest_TrackerBenchmark();
 
 	}; // class CMemoryPoolBasicTest
 }
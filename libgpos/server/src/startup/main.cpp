@@ -36,6 +36,7 @@
 #include "unittest/gpos/common/CListTest.h"
 #include "unittest/gpos/common/CRefCountTest.h"
 #include "unittest/gpos/common/CStackTest.h"
+#include "unittest/gpos/common/CStripedHashtableTest.h"
 #include "unittest/gpos/common/CSyncHashtableTest.h"
 #include "unittest/gpos/common/CSyncListTest.h"
 
@@ -96,6 +97,7 @@ static gpos::CUnittest rgut[] =
 	GPOS_UNITTEST_STD(CRefCountTest),
 	GPOS_UNITTEST_STD(CListTest),
 	GPOS_UNITTEST_STD(CStackTest),
+	GPOS_UNITTEST_STD(CStripedHashtableTest),
 	GPOS_UNITTEST_STD(CSyncHashtableTest),
 	GPOS_UNITTEST_STD(CSyncListTest),
 
@@ -0,0 +1,295 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CStripedHashtableTest.cpp
+//
+//	@doc:
+//      Tests for CStripedHashtable
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpos/memory/CAutoMemoryPool.h"
+
+#include "gpos/task/CAutoTaskProxy.h"
+
+#include "gpos/test/CUnittest.h"
+
+#include "unittest/gpos/common/CStripedHashtableTest.h"
+
+using namespace gpos;
+
+#define GPOS_STHT_STRIPES	4
+#define GPOS_STHT_BUCKETS	1
+#define GPOS_STHT_ELEMENTS	1000
+#define GPOS_STHT_THREADS	8
+
+
+// invalid key
+const ULONG CStripedHashtableTest::SElem::m_ulInvalid = gpos::ulong_max;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStripedHashtableTest::EresUnittest
+//
+//	@doc:
+//		Unittest for striped hashtable
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CStripedHashtableTest::EresUnittest()
+{
+	CUnittest rgut[] =
+		{
+		GPOS_UNITTEST_FUNC(CStripedHashtableTest::EresUnittest_Basics),
+		GPOS_UNITTEST_FUNC(CStripedHashtableTest::EresUnittest_Grow),
+		GPOS_UNITTEST_FUNC(CStripedHashtableTest::EresUnittest_Concurrency)
+		};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStripedHashtableTest::EresUnittest_Basics
+//
+//	@doc:
+//		Insert, lookup and removal through accessor
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CStripedHashtableTest::EresUnittest_Basics()
+{
+	CAutoMemoryPool amp;
+	IMemoryPool *mp = amp.Pmp();
+
+	SElem *rgelem = GPOS_NEW_ARRAY(mp, SElem, GPOS_STHT_ELEMENTS);
+
+	SElemHashtable sht;
+	sht.Init
+		(
+		mp,
+		GPOS_STHT_STRIPES,
+		GPOS_STHT_BUCKETS,
+		GPOS_OFFSET(SElem, m_link),
+		GPOS_OFFSET(SElem, m_ulKey),
+		&(SElem::m_ulInvalid),
+		SElem::HashValue,
+		SElem::FEqualKeys
+		);
+
+	for (ULONG i = 0; i < GPOS_STHT_ELEMENTS; i++)
+	{
+		rgelem[i].m_ulKey = i;
+
+		SElemHashtableAccessor shtacc(sht, rgelem[i].m_ulKey);
+		GPOS_RTL_ASSERT(NULL == shtacc.Find());
+		shtacc.Insert(&rgelem[i]);
+	}
+	GPOS_RTL_ASSERT(GPOS_STHT_ELEMENTS == sht.Size());
+
+	// remove elements with even keys
+	for (ULONG i = 0; i < GPOS_STHT_ELEMENTS; i += 2)
+	{
+		SElemHashtableAccessor shtacc(sht, rgelem[i].m_ulKey);
+		GPOS_RTL_ASSERT(&rgelem[i] == shtacc.Find());
+		shtacc.Remove(&rgelem[i]);
+	}
+	GPOS_RTL_ASSERT(GPOS_STHT_ELEMENTS / 2 == sht.Size());
+
+	for (ULONG i = 0; i < GPOS_STHT_ELEMENTS; i++)
+	{
+		SElemHashtableAccessor shtacc(sht, rgelem[i].m_ulKey);
+		SElem *pelem = shtacc.Find();
+		if (0 == i % 2)
+		{
+			GPOS_RTL_ASSERT(NULL == pelem);
+		}
+		else
+		{
+			GPOS_RTL_ASSERT(&rgelem[i] == pelem);
+			GPOS_RTL_ASSERT(NULL == shtacc.Next(pelem));
+		}
+	}
+
+	// drain remaining elements
+	CList<SElem> list;
+	list.Init(GPOS_OFFSET(SElem, m_link));
+	sht.RemoveAll(&list);
+
+	GPOS_RTL_ASSERT(0 == sht.Size());
+	GPOS_RTL_ASSERT(GPOS_STHT_ELEMENTS / 2 == list.Size());
+
+	GPOS_DELETE_ARRAY(rgelem);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStripedHashtableTest::EresUnittest_Grow
+//
+//	@doc:
+//		Stripes grow as elements are inserted and keep all elements reachable
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CStripedHashtableTest::EresUnittest_Grow()
+{
+	CAutoMemoryPool amp;
+	IMemoryPool *mp = amp.Pmp();
+
+	SElem *rgelem = GPOS_NEW_ARRAY(mp, SElem, GPOS_STHT_ELEMENTS);
+
+	SElemHashtable sht;
+	sht.Init
+		(
+		mp,
+		GPOS_STHT_STRIPES,
+		GPOS_STHT_BUCKETS,
+		GPOS_OFFSET(SElem, m_link),
+		GPOS_OFFSET(SElem, m_ulKey),
+		&(SElem::m_ulInvalid),
+		SElem::HashValue,
+		SElem::FEqualKeys
+		);
+
+	for (ULONG i = 0; i < GPOS_STHT_ELEMENTS; i++)
+	{
+		// use sparse keys to exercise the per-stripe bucket index
+		rgelem[i].m_ulKey = i * 7919;
+
+		SElemHashtableAccessor shtacc(sht, rgelem[i].m_ulKey);
+		shtacc.Insert(&rgelem[i]);
+	}
+
+	// load factor is bounded after growing
+	GPOS_RTL_ASSERT(GPOS_STHT_STRIPES * GPOS_STHT_BUCKETS < sht.Buckets());
+	GPOS_RTL_ASSERT(sht.Size() <= GPOS_STRIPED_HT_MAX_LOAD * sht.Buckets());
+
+	for (ULONG i = 0; i < GPOS_STHT_ELEMENTS; i++)
+	{
+		SElemHashtableAccessor shtacc(sht, rgelem[i].m_ulKey);
+		GPOS_RTL_ASSERT(&rgelem[i] == shtacc.Find());
+	}
+
+	GPOS_DELETE_ARRAY(rgelem);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStripedHashtableTest::EresUnittest_Concurrency
+//
+//	@doc:
+//		Concurrent test-and-insert of overlapping key sets; exactly one
+//		element per distinct key must end up in the hashtable
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CStripedHashtableTest::EresUnittest_Concurrency()
+{
+	CAutoMemoryPool amp;
+	IMemoryPool *mp = amp.Pmp();
+
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	GPOS_ASSERT(GPOS_STHT_THREADS <= pwpm->GetMaxWorkers() &&
+				"Insufficient number of workers to run test");
+
+	SElemHashtable sht;
+	sht.Init
+		(
+		mp,
+		GPOS_STHT_STRIPES,
+		GPOS_STHT_BUCKETS,
+		GPOS_OFFSET(SElem, m_link),
+		GPOS_OFFSET(SElem, m_ulKey),
+		&(SElem::m_ulInvalid),
+		SElem::HashValue,
+		SElem::FEqualKeys
+		);
+
+	SElem *rgelem = GPOS_NEW_ARRAY(mp, SElem, GPOS_STHT_ELEMENTS * GPOS_STHT_THREADS);
+
+	// every task attempts to insert the same keys
+	SElemTest rgelemtest[GPOS_STHT_THREADS];
+	for (ULONG i = 0; i < GPOS_STHT_THREADS; i++)
+	{
+		rgelemtest[i].m_psht = &sht;
+		rgelemtest[i].m_rgelem = rgelem + i * GPOS_STHT_ELEMENTS;
+		rgelemtest[i].m_ulElems = GPOS_STHT_ELEMENTS;
+		rgelemtest[i].m_ulKeys = GPOS_STHT_ELEMENTS / 2;
+	}
+
+	// scope for tasks
+	{
+		CAutoTaskProxy atp(mp, pwpm);
+
+		CTask *rgtask[GPOS_STHT_THREADS];
+		for (ULONG i = 0; i < GPOS_STHT_THREADS; i++)
+		{
+			rgtask[i] = atp.Create(PvUnittest_Inserter, &rgelemtest[i]);
+			atp.Schedule(rgtask[i]);
+		}
+
+		for (ULONG i = 0; i < GPOS_STHT_THREADS; i++)
+		{
+			GPOS_CHECK_ABORT;
+
+			atp.Wait(rgtask[i]);
+		}
+	}
+
+	GPOS_RTL_ASSERT(GPOS_STHT_ELEMENTS / 2 == sht.Size());
+
+	GPOS_DELETE_ARRAY(rgelem);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStripedHashtableTest::PvUnittest_Inserter
+//
+//	@doc:
+//		Inserter task; inserts an element unless its key is already present
+//
+//---------------------------------------------------------------------------
+void *
+CStripedHashtableTest::PvUnittest_Inserter
+	(
+	void *pv
+	)
+{
+	SElemTest *pelemtest = static_cast<SElemTest *>(pv);
+
+	for (ULONG i = 0; i < pelemtest->m_ulElems; i++)
+	{
+		SElem *pelem = &pelemtest->m_rgelem[i];
+		pelem->m_ulKey = i % pelemtest->m_ulKeys;
+
+		// hash table accessor scope
+		{
+			SElemHashtableAccessor shtacc(*pelemtest->m_psht, pelem->m_ulKey);
+			if (NULL == shtacc.Find())
+			{
+				shtacc.Insert(pelem);
+			}
+		}
+
+		GPOS_CHECK_ABORT;
+	}
+
+	return NULL;
+}
+
+// EOF
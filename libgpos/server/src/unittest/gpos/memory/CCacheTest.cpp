@@ -12,6 +12,7 @@
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/common/CAutoP.h"
 #include "gpos/common/CRandom.h"
+#include "gpos/common/CWallClock.h"
 
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/memory/CCacheFactory.h"
@@ -30,6 +31,15 @@ using namespace gpos;
 #define GPOS_CACHE_DUPLICATES	5
 #define GPOS_CACHE_DUPLICATES_TO_DELETE		3
 
+// benchmark settings: tasks, key range and operations per task
+#define GPOS_CACHE_BENCH_TASKS	8
+#define GPOS_CACHE_BENCH_KEYS	4096
+#ifdef GPOS_DEBUG
+#define GPOS_CACHE_BENCH_OPS	2000
+#else
+#define GPOS_CACHE_BENCH_OPS	50000
+#endif // GPOS_DEBUG
+
 // static variable
 static BOOL fUnique = true;
 
@@ -52,7 +62,8 @@ CCacheTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Iteration),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_DeepObject),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion),
-		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_ConcurrentAccess)
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_ConcurrentAccess),
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_ShardedBenchmark)
 		};
 
 	fUnique = true;
@@ -1205,4 +1216,179 @@ CCacheTest::EresUnittest_ConcurrentAccess()
 	return GPOS_OK;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::PvBenchmarkTask
+//
+//	@doc:
+//		A task that looks up random keys and inserts the missing ones;
+//		the key range exceeds the cache quota, so inserts trigger eviction
+//
+//---------------------------------------------------------------------------
+void *
+CCacheTest::PvBenchmarkTask
+	(
+	void *pv
+	)
+{
+	SBenchmarkArgs *pargs = (SBenchmarkArgs *) pv;
+	CCache<SSimpleObject*, ULONG*> *pcache = pargs->m_pcache;
+	CRandom rand(pargs->m_ulSeed);
+
+	for (ULONG i = 0; i < GPOS_CACHE_BENCH_OPS; i++)
+	{
+		ULONG ulKey = rand.Next() % GPOS_CACHE_BENCH_KEYS;
+
+		CSimpleObjectCacheAccessor ca(pcache);
+		ca.Lookup(&ulKey);
+		SSimpleObject *pso = ca.Val();
+
+		if (NULL != pso)
+		{
+			// release object since there is no customer to release it after lookup
+			pso->Release();
+		}
+		else
+		{
+			CSimpleObjectCacheAccessor caInsert(pcache);
+			IMemoryPool *mp = caInsert.Pmp();
+			pso = GPOS_NEW(mp) SSimpleObject(ulKey, ulKey);
+			caInsert.Insert(&(pso->m_ulKey), pso);
+
+			// the cache entry keeps its ownership of the object
+			pso->Release();
+		}
+
+		if (0 == i % 100)
+		{
+			GPOS_CHECK_ABORT;
+		}
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::UlBenchmark
+//
+//	@doc:
+//		Run benchmark tasks concurrently against a cache; return elapsed
+//		time in ms
+//
+//---------------------------------------------------------------------------
+ULONG
+CCacheTest::UlBenchmark
+	(
+	CCache<SSimpleObject*, ULONG*> *pcache
+	)
+{
+	CAutoMemoryPool amp;
+	IMemoryPool *mp = amp.Pmp();
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	SBenchmarkArgs rgargs[GPOS_CACHE_BENCH_TASKS];
+	CTask *rgPtsk[GPOS_CACHE_BENCH_TASKS];
+
+	CAutoTaskProxy atp(mp, pwpm);
+
+	for (ULONG i = 0; i < GPOS_CACHE_BENCH_TASKS; i++)
+	{
+		rgargs[i].m_pcache = pcache;
+		rgargs[i].m_ulSeed = i + 1;
+		rgPtsk[i] = atp.Create(PvBenchmarkTask, &rgargs[i]);
+	}
+
+	CWallClock clock;
+
+	for (ULONG i = 0; i < GPOS_CACHE_BENCH_TASKS; i++)
+	{
+		atp.Schedule(rgPtsk[i]);
+	}
+
+	for (ULONG i = 0; i < GPOS_CACHE_BENCH_TASKS; i++)
+	{
+		atp.Wait(rgPtsk[i]);
+	}
+
+	return clock.ElapsedMS();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::EresUnittest_ShardedBenchmark
+//
+//	@doc:
+//		Compare throughput of concurrent lookups, inserts and evictions
+//		of a single-shard cache and a sharded cache with the same quota
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CCacheTest::EresUnittest_ShardedBenchmark()
+{
+	CAutoMemoryPool amp;
+	IMemoryPool *mp = amp.Pmp();
+
+	// size of a single cached object
+	ULLONG ullOneElemSize = 0;
+	{
+		CAutoP<CCache<SSimpleObject*, ULONG*> > apcache;
+		apcache = CCacheFactory::CreateCache<SSimpleObject*, ULONG*>
+					(
+					fUnique,
+					UNLIMITED_CACHE_QUOTA,
+					SSimpleObject::UlMyHash,
+					SSimpleObject::FMyEqual
+					);
+		ullOneElemSize = InsertOneElement(apcache.Value(), 0);
+	}
+
+	// quota holds a quarter of the key range
+	const ULLONG ullQuota = ullOneElemSize * GPOS_CACHE_BENCH_KEYS / 4;
+	const ULONG rgulShards[] = {1, CCACHE_NUM_SHARDS};
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgulShards); ul++)
+	{
+		CAutoP<CCache<SSimpleObject*, ULONG*> > apcache;
+		apcache = CCacheFactory::CreateShardedCache<SSimpleObject*, ULONG*>
+					(
+					fUnique,
+					ullQuota,
+					SSimpleObject::UlMyHash,
+					SSimpleObject::FMyEqual,
+					rgulShards[ul]
+					);
+
+		CCache<SSimpleObject*, ULONG*> *pcache = apcache.Value();
+		GPOS_RTL_ASSERT(rgulShards[ul] == pcache->NumShards());
+
+		ULONG ulTime = UlBenchmark(pcache);
+
+		GPOS_RTL_ASSERT(0 < pcache->Size());
+		GPOS_RTL_ASSERT(0 < pcache->GetEvictionCounter());
+
+		// inserters skip eviction while another thread evicts from the same
+		// shard, so a single shard may overshoot its quota; shards must stay
+		// close to theirs
+		GPOS_RTL_ASSERT(1 == rgulShards[ul] || pcache->TotalAllocatedSize() < 2 * ullQuota);
+
+		const ULLONG ullOps = (ULLONG) GPOS_CACHE_BENCH_TASKS * GPOS_CACHE_BENCH_OPS;
+
+		CAutoTrace at(mp);
+		at.Os()
+			<< "\t* " << rgulShards[ul] << " shard(s), "
+			<< GPOS_CACHE_BENCH_TASKS << " tasks: "
+			<< (ullOps * 1000 / std::max(ulTime, (ULONG) 1)) << " ops/sec, "
+			<< pcache->Size() << " entries, "
+			<< (pcache->TotalAllocatedSize() / 1024) << " KB (quota "
+			<< (ullQuota / 1024) << " KB), "
+			<< pcache->GetEvictionCounter() << " evictions";
+	}
+
+	return GPOS_OK;
+}
+
 // EOF
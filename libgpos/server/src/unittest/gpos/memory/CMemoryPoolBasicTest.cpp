@@ -12,7 +12,10 @@
 #include "gpos/assert.h"
 #include "gpos/common/clibwrapper.h"
 #include "gpos/common/CAutoTimer.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/common/syslibwrapper.h"
 #include "gpos/error/CErrorHandlerStandard.h"
+#include "gpos/error/CAutoTrace.h"
 #include "gpos/error/CException.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
@@ -35,13 +38,21 @@
 #define GPOS_MEM_TEST_LOOP_SHORT	(10)
 #define GPOS_MEM_TEST_LOOP_STRESS	(100)
 #define GPOS_MEM_TEST_LOOP_LONG 	(1000)
+#define GPOS_MEM_TEST_BENCH_ALLOCS	(10000)
 #else
 #define GPOS_MEM_TEST_CFA           (100)
 #define GPOS_MEM_TEST_LOOP_SHORT	(100)
 #define GPOS_MEM_TEST_LOOP_STRESS	(1000)
 #define GPOS_MEM_TEST_LOOP_LONG 	(100000)
+#define GPOS_MEM_TEST_BENCH_ALLOCS	(1000000)
 #endif // GPOS_DEBUG
 
+// number of tasks for concurrent benchmark runs
+#define GPOS_MEM_TEST_BENCH_TASKS	(4)
+
+// every n-th allocation of a benchmark task is a temporary that is released immediately
+#define GPOS_MEM_TEST_BENCH_FREE	(4)
+
 #define GPOS_MEM_TEST_REPEAT_SHORT	(GPOS_MEM_TEST_LOOP_LONG / GPOS_MEM_TEST_LOOP_SHORT)
 
 using namespace gpos;
@@ -64,6 +75,9 @@ CMemoryPoolBasicTest::EresUnittest()
 #endif // GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker),
 		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestStack),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestArena),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_ArenaBenchmark),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TrackerBenchmark),
 		};
 
 	CAutoTraceFlag atf(EtraceTestMemoryPools, true /*value*/);
@@ -131,6 +145,123 @@ CMemoryPoolBasicTest::EresUnittest_TestStack()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_TestArena
+//
+//	@doc:
+//		Run tests for pool using per-thread chunks
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_TestArena()
+{
+	return EresTestType(CMemoryPoolManager::EatArena);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_ArenaBenchmark
+//
+//	@doc:
+//		Compare allocation throughput and memory footprint of tracker and
+//		arena pools for a workload of small objects that mostly live until
+//		the pool is destroyed, as optimizer objects do
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_ArenaBenchmark()
+{
+	CAutoMemoryPool amp;
+	IMemoryPool *mp = amp.Pmp();
+
+	const CMemoryPoolManager::AllocType rgeat[] =
+		{
+		CMemoryPoolManager::EatTracker,
+		CMemoryPoolManager::EatArena
+		};
+	const CHAR *rgszPool[] = {"tracker", "arena"};
+	const ULONG rgulTasks[] = {1, GPOS_MEM_TEST_BENCH_TASKS};
+
+	for (ULONG ulTasks = 0; ulTasks < GPOS_ARRAY_SIZE(rgulTasks); ulTasks++)
+	{
+		for (ULONG ulPool = 0; ulPool < GPOS_ARRAY_SIZE(rgeat); ulPool++)
+		{
+			ULLONG ullFootprint = 0;
+			ULONG ulTime = UlBenchmark(rgeat[ulPool], rgulTasks[ulTasks], &ullFootprint);
+			GPOS_RTL_ASSERT(0 < ullFootprint);
+
+			const ULLONG ullAllocs = (ULLONG) rgulTasks[ulTasks] * GPOS_MEM_TEST_BENCH_ALLOCS;
+
+			// peak resident set size of the process so far
+			RUSAGE rusage;
+			syslib::GetRusage(&rusage);
+
+			CAutoTrace at(mp);
+			at.Os()
+				<< "\t* " << rgszPool[ulPool] << " pool, "
+				<< rgulTasks[ulTasks] << " task(s): "
+				<< (ullAllocs * 1000 / std::max(ulTime, (ULONG) 1)) << " allocs/sec, "
+				<< "footprint " << (ullFootprint / 1024) << " KB, "
+				<< "peak RSS " << rusage.ru_maxrss << " KB";
+		}
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_TrackerBenchmark
+//
+//	@doc:
+//		Compare allocation throughput of tracker pools with and without
+//		size-class magazines; the pool's allocated size must not depend
+//		on whether magazines are used
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_TrackerBenchmark()
+{
+	CAutoMemoryPool amp;
+	IMemoryPool *mp = amp.Pmp();
+
+	const BOOL rgfMagazines[] = {false, true};
+	const ULONG rgulTasks[] = {1, GPOS_MEM_TEST_BENCH_TASKS};
+
+	for (ULONG ulTasks = 0; ulTasks < GPOS_ARRAY_SIZE(rgulTasks); ulTasks++)
+	{
+		ULLONG rgullFootprint[GPOS_ARRAY_SIZE(rgfMagazines)];
+
+		for (ULONG ulMode = 0; ulMode < GPOS_ARRAY_SIZE(rgfMagazines); ulMode++)
+		{
+			ULONG ulTime = 0;
+
+			// scope for trace flag; flag is inherited by benchmark tasks
+			{
+				CAutoTraceFlag atf(EtraceDisableMemoryMagazines, !rgfMagazines[ulMode]);
+				ulTime = UlBenchmark(CMemoryPoolManager::EatTracker, rgulTasks[ulTasks], &rgullFootprint[ulMode]);
+			}
+
+			const ULLONG ullAllocs = (ULLONG) rgulTasks[ulTasks] * GPOS_MEM_TEST_BENCH_ALLOCS;
+
+			CAutoTrace at(mp);
+			at.Os()
+				<< "\t* tracker pool, magazines " << (rgfMagazines[ulMode] ? "on" : "off") << ", "
+				<< rgulTasks[ulTasks] << " task(s): "
+				<< (ullAllocs * 1000 / std::max(ulTime, (ULONG) 1)) << " allocs/sec, "
+				<< "footprint " << (rgullFootprint[ulMode] / 1024) << " KB";
+		}
+
+		GPOS_RTL_ASSERT(rgullFootprint[0] == rgullFootprint[1]);
+	}
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemoryPoolBasicTest::EresTestType
@@ -739,4 +870,103 @@ CMemoryPoolBasicTest::AllocateRandom
 }
 
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::UlBenchmark
+//
+//	@doc:
+//		Run benchmark tasks against a new pool of the given type; return
+//		elapsed time in ms and the pool's allocated size before teardown
+//
+//---------------------------------------------------------------------------
+ULONG
+CMemoryPoolBasicTest::UlBenchmark
+	(
+	CMemoryPoolManager::AllocType eat,
+	ULONG ulTasks,
+	ULLONG *pullFootprint
+	)
+{
+	GPOS_ASSERT(ulTasks <= GPOS_MEM_TEST_BENCH_TASKS);
+	GPOS_ASSERT(NULL != pullFootprint);
+
+	// tasks are allocated from a separate pool to not distort the footprint
+	CAutoMemoryPool ampTasks;
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcNone, eat, true /*fThreadSafe*/);
+	IMemoryPool *mp = amp.Pmp();
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	ULONG ulTime = 0;
+
+	// scope for ATP
+	{
+		CAutoTaskProxy atp(ampTasks.Pmp(), pwpm);
+		CTask *rgptsk[GPOS_MEM_TEST_BENCH_TASKS];
+
+		for (ULONG i = 0; i < ulTasks; i++)
+		{
+			rgptsk[i] = atp.Create(AllocateBenchmark, mp);
+		}
+
+		CWallClock clock;
+
+		for (ULONG i = 0; i < ulTasks; i++)
+		{
+			atp.Schedule(rgptsk[i]);
+		}
+
+		for (ULONG i = 0; i < ulTasks; i++)
+		{
+			atp.Wait(rgptsk[i]);
+		}
+
+		ulTime = clock.ElapsedMS();
+	}
+
+	*pullFootprint = mp->TotalAllocatedSize();
+
+	return ulTime;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::AllocateBenchmark
+//
+//	@doc:
+//		Allocate objects of typical optimizer sizes; most of them are left
+//		to be released by the pool teardown
+//
+//---------------------------------------------------------------------------
+void *
+CMemoryPoolBasicTest::AllocateBenchmark
+	(
+	void *pv
+	)
+{
+	GPOS_ASSERT(NULL != pv);
+
+	IMemoryPool *mp = static_cast<IMemoryPool*>(pv);
+
+	const ULONG rgulSize[] = {16, 24, 40, 64, 96, 128, 192, 256};
+
+	for (ULONG i = 0; i < GPOS_MEM_TEST_BENCH_ALLOCS; i++)
+	{
+		BYTE *pb = GPOS_NEW_ARRAY(mp, BYTE, rgulSize[i % GPOS_ARRAY_SIZE(rgulSize)]);
+
+		if (0 == i % GPOS_MEM_TEST_BENCH_FREE)
+		{
+			GPOS_DELETE_ARRAY(pb);
+		}
+
+		if (0 == i % GPOS_MEM_TEST_CFA)
+		{
+			GPOS_CHECK_ABORT;
+		}
+	}
+
+	return NULL;
+}
+
 // EOF
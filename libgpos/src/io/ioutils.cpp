@@ -19,6 +19,7 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 
 #include "gpos/base.h"
 #include "gpos/common/clibwrapper.h"
@@ -550,6 +551,60 @@ gpos::ioutils::CreateTempDir
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		ioutils::MapFile
+//
+//	@doc:
+//		Map file contents into memory for reading; the mapping stays valid
+//		after the file descriptor is closed
+//
+//---------------------------------------------------------------------------
+const void *
+gpos::ioutils::MapFile
+	(
+	INT file_descriptor,
+	ULLONG size
+	)
+{
+	GPOS_ASSERT_NO_SPINLOCK;
+	GPOS_ASSERT(0 < size);
+
+	void *addr = mmap(NULL, (SIZE_T) size, PROT_READ, MAP_PRIVATE, file_descriptor, 0 /*offset*/);
+
+	if (MAP_FAILED == addr)
+	{
+		GPOS_RAISE(CException::ExmaSystem, CException::ExmiIOError, errno);
+	}
+
+	return addr;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		ioutils::UnmapFile
+//
+//	@doc:
+//		Unmap file contents mapped by MapFile
+//
+//---------------------------------------------------------------------------
+void
+gpos::ioutils::UnmapFile
+	(
+	const void *addr,
+	ULLONG size
+	)
+{
+	GPOS_ASSERT(NULL != addr);
+
+	INT res = munmap(const_cast<void*>(addr), (SIZE_T) size);
+
+	GPOS_ASSERT(0 == res);
+	(void) res;
+}
+
+
 #ifdef GPOS_FPSIMULATOR
 
 
@@ -0,0 +1,286 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CMemoryPoolArena.cpp
+//
+//	@doc:
+//		Implementation of memory pool that hands out memory from per-thread
+//		chunks by bumping an offset.
+//
+//	@owner:
+//
+//	@test:
+//
+//---------------------------------------------------------------------------
+
+#include "gpos/assert.h"
+#include "gpos/types.h"
+#include "gpos/utils.h"
+#include "gpos/memory/CMemoryPoolArena.h"
+#include "gpos/memory/CMemoryPoolManager.h"
+#include "gpos/sync/atomic.h"
+#include "gpos/task/CWorkerId.h"
+
+
+#define GPOS_MEM_ARENA_CHUNK_SIZE (256 * 1024)
+
+#define GPOS_MEM_ARENA_CHUNK_HEADER_SIZE \
+	(GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunk))
+
+// requests larger than this fraction of the chunk size get a dedicated chunk
+#define GPOS_MEM_ARENA_LARGE_FRACTION (8)
+
+
+using namespace gpos;
+
+GPOS_CPL_ASSERT(MAX_ALIGNED(GPOS_MEM_ARENA_CHUNK_SIZE));
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArena::CMemoryPoolArena
+//
+//	@doc:
+//	  ctor
+//
+//---------------------------------------------------------------------------
+CMemoryPoolArena::CMemoryPoolArena
+	(
+	IMemoryPool *mp,
+	ULLONG capacity,
+	BOOL thread_safe,
+	BOOL owns_underlying_memory_pool
+	)
+	:
+	CMemoryPool(mp, owns_underlying_memory_pool, thread_safe),
+	m_reserved(0),
+	m_capacity(capacity),
+	m_chunk_size(GPOS_MEM_ALIGNED_SIZE(GPOS_MEM_ARENA_CHUNK_SIZE))
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(GPOS_MEM_ARENA_CHUNK_SIZE < m_capacity);
+
+	for (ULONG ul = 0; ul < GPOS_MEM_ARENA_SLOTS; ul++)
+	{
+		m_slots[ul].m_chunk = NULL;
+	}
+
+	m_chunk_list.Init(GPOS_OFFSET(SChunk, m_link));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArena::~CMemoryPoolArena
+//
+//	@doc:
+//		Dtor.
+//
+//---------------------------------------------------------------------------
+CMemoryPoolArena::~CMemoryPoolArena()
+{
+	GPOS_ASSERT(m_chunk_list.IsEmpty());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArena::Allocate
+//
+//	@doc:
+//		Allocate memory by advancing the offset in the current chunk of the
+//		calling thread's slot; large requests get a dedicated chunk.
+//
+//---------------------------------------------------------------------------
+void *
+CMemoryPoolArena::Allocate
+	(
+	ULONG bytes,
+	const CHAR *,  // szFile
+	const ULONG    // line
+	)
+{
+	GPOS_ASSERT(GPOS_MEM_ALLOC_MAX >= bytes);
+
+	ULONG alloc = GPOS_MEM_ALIGNED_SIZE(bytes);
+	GPOS_ASSERT(MAX_ALIGNED(alloc));
+
+	if (alloc > m_chunk_size / GPOS_MEM_ARENA_LARGE_FRACTION)
+	{
+		// dedicated chunk is not shared, no need to lock a slot
+		SChunk *chunk = New(alloc);
+		if (NULL == chunk)
+		{
+			return NULL;
+		}
+
+		return chunk->Reserve(alloc);
+	}
+
+	SSlot &slot = GetSlot();
+
+	CAutoSpinlock as(slot.m_lock);
+	if (IsThreadSafe())
+	{
+		as.Lock();
+	}
+
+	if (NULL == slot.m_chunk || !slot.m_chunk->CanFit(alloc))
+	{
+		// remainder of the current chunk is abandoned
+		SChunk *chunk = New(alloc);
+		if (NULL == chunk)
+		{
+			return NULL;
+		}
+
+		slot.m_chunk = chunk;
+	}
+
+	return slot.m_chunk->Reserve(alloc);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArena::GetSlot
+//
+//	@doc:
+//		Find slot of the calling thread; pools that are not thread-safe
+//		use a single slot
+//
+//---------------------------------------------------------------------------
+CMemoryPoolArena::SSlot &
+CMemoryPoolArena::GetSlot()
+{
+	if (!IsThreadSafe())
+	{
+		return m_slots[0];
+	}
+
+	CWorkerId wid;
+	return m_slots[CWorkerId::HashValue(wid) % GPOS_MEM_ARENA_SLOTS];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArena::New
+//
+//	@doc:
+//		Allocate chunk from underlying pool and append it to chunk list;
+//		requests larger than a fraction of the default chunk size get a
+//		chunk of their own size
+//
+//---------------------------------------------------------------------------
+CMemoryPoolArena::SChunk *
+CMemoryPoolArena::New
+	(
+	ULONG alloc
+	)
+{
+	ULONG chunk_size = m_chunk_size;
+	if (alloc > m_chunk_size / GPOS_MEM_ARENA_LARGE_FRACTION)
+	{
+		chunk_size = alloc + (ULONG) GPOS_MEM_ARENA_CHUNK_HEADER_SIZE;
+	}
+	GPOS_ASSERT(MAX_ALIGNED(chunk_size));
+
+	// reserve capacity before going to the underlying pool
+	ULLONG reserved = ExchangeAddUllongWithUllong(&m_reserved, chunk_size);
+	if (reserved + chunk_size > m_capacity)
+	{
+		(void) ExchangeAddUllongWithUllong(&m_reserved, -(ULLONG) chunk_size);
+		return NULL;
+	}
+
+	// allocate memory and put chunk descriptor to the beginning of it
+	SChunk *chunk = static_cast<SChunk*>
+			(
+			GetUnderlyingMemoryPool()->Allocate(chunk_size, __FILE__, __LINE__)
+			);
+
+	if (NULL == chunk)
+	{
+		(void) ExchangeAddUllongWithUllong(&m_reserved, -(ULLONG) chunk_size);
+		return NULL;
+	}
+
+	chunk->Init(chunk_size);
+
+	// keep track of new chunk
+	CAutoSpinlock as(m_lock);
+	as.Lock();
+	m_chunk_list.Append(chunk);
+
+	return chunk;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArena::TearDown
+//
+//	@doc:
+//		Return all chunks to the underlying pool and tear it down.
+//
+//---------------------------------------------------------------------------
+void
+CMemoryPoolArena::TearDown()
+{
+	GPOS_ASSERT(!m_lock.IsOwned());
+
+	while (!m_chunk_list.IsEmpty())
+	{
+		GetUnderlyingMemoryPool()->Free(m_chunk_list.RemoveHead());
+	}
+
+	for (ULONG ul = 0; ul < GPOS_MEM_ARENA_SLOTS; ul++)
+	{
+		m_slots[ul].m_chunk = NULL;
+	}
+
+	CMemoryPool::TearDown();
+
+	m_reserved = 0;
+}
+
+#ifdef GPOS_DEBUG
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArena::CheckAllocation
+//
+//	@doc:
+//		Verifies that an allocation is correct and came from this pool.
+//
+//---------------------------------------------------------------------------
+void
+CMemoryPoolArena::CheckAllocation
+	(
+	void *ptr
+	)
+{
+	CAutoSpinlock as(m_lock);
+	as.Lock();
+
+	SChunk *chunk = m_chunk_list.First();
+	while (NULL != chunk)
+	{
+		if (ptr >= GPOS_MEM_OFFSET_POS(chunk, GPOS_MEM_ARENA_CHUNK_HEADER_SIZE) &&
+			ptr < GPOS_MEM_OFFSET_POS(chunk, chunk->m_used_size))
+		{
+			return;
+		}
+
+		chunk = m_chunk_list.Next(chunk);
+	}
+
+	GPOS_ASSERT(!"object is allocated in one of the chunks");
+}
+
+#endif // GPOS_DEBUG
+
+// EOF
@@ -19,6 +19,7 @@
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/memory/IMemoryPool.h"
 #include "gpos/memory/CMemoryPoolAlloc.h"
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryPoolInjectFault.h"
 #include "gpos/memory/CMemoryPoolManager.h"
 #include "gpos/memory/CMemoryPoolStack.h"
@@ -215,6 +216,15 @@ CMemoryPoolManager::New
 						thread_safe,
 						owns_underlying_memory_pool
 						);
+
+		case CMemoryPoolManager::EatArena:
+			return GPOS_NEW(m_internal_memory_pool) CMemoryPoolArena
+						(
+						underlying_memory_pool,
+						capacity,
+						thread_safe,
+						owns_underlying_memory_pool
+						);
 	}
 
 	GPOS_ASSERT(!"No matching pool type found");
@@ -26,6 +26,9 @@
 #include "gpos/memory/CMemoryPoolTracker.h"
 #include "gpos/memory/IMemoryVisitor.h"
 #include "gpos/sync/CAutoMutex.h"
+#include "gpos/sync/atomic.h"
+#include "gpos/task/CWorkerId.h"
+#include "gpos/task/ITask.h"
 
 using namespace gpos;
 
@@ -36,6 +39,27 @@ using namespace gpos;
 #define GPOS_MEM_BYTES_TOTAL(ulNumBytes) \
 	(GPOS_MEM_ALLOC_HEADER_SIZE + GPOS_MEM_ALIGNED_SIZE(ulNumBytes))
 
+// number of allocations after which a pool starts using magazines
+#define GPOS_MEM_MAGAZINE_THRESHOLD		(1024)
+
+// max number of free blocks per size class in a slot's magazine
+#define GPOS_MEM_MAGAZINE_CAPACITY		(64)
+
+// number of blocks moved between magazines and depot at once
+#define GPOS_MEM_MAGAZINE_BATCH			(32)
+
+// number of magazine operations of a slot between statistics aggregations
+#define GPOS_MEM_MAGAZINE_STATS_INTERVAL	(256)
+
+// size class of a request, blocks of class c hold (c + 1) * GPOS_MEM_ARCH bytes
+#define GPOS_MEM_MAGAZINE_CLASS(ulNumBytes) \
+	(GPOS_MEM_ALIGNED_SIZE(ulNumBytes) / GPOS_MEM_ARCH - 1)
+
+#define GPOS_MEM_MAGAZINE_CHUNK_HEADER_SIZE \
+	GPOS_MEM_ALIGNED_STRUCT_SIZE(SLink)
+
+GPOS_CPL_ASSERT(GPOS_MEM_MAGAZINE_CAPACITY >= GPOS_MEM_MAGAZINE_BATCH);
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -54,6 +78,7 @@ CMemoryPoolTracker::CMemoryPoolTracker
 	)
 	:
 	CMemoryPool(underlying_memory_pool, owns_underlying_memory_pool, thread_safe),
+	m_magazine_cache(NULL),
 	m_alloc_sequence(0),
 	m_capacity(max_size),
 	m_reserved(0)
@@ -74,6 +99,7 @@ CMemoryPoolTracker::CMemoryPoolTracker
 //---------------------------------------------------------------------------
 CMemoryPoolTracker::~CMemoryPoolTracker()
 {
+	GPOS_ASSERT(NULL == m_magazine_cache);
 	GPOS_ASSERT(m_allocations_list.IsEmpty());
 }
 
@@ -96,6 +122,11 @@ CMemoryPoolTracker::Allocate
 {
 	GPOS_ASSERT(GPOS_MEM_ALLOC_MAX >= bytes);
 
+	if (FUseMagazine(bytes))
+	{
+		return AllocateFromMagazine(bytes, file, line);
+	}
+
 	CAutoSpinlock as(m_lock);
 
 	ULONG alloc = GPOS_MEM_BYTES_TOTAL(bytes);
@@ -138,6 +169,7 @@ CMemoryPoolTracker::Allocate
 	header->m_filename = file;
 	header->m_line = line;
 	header->m_size = bytes;
+	header->m_magazine = false;
 
 	void *ptr_result = header + 1;
 
@@ -145,12 +177,336 @@ CMemoryPoolTracker::Allocate
 	header->m_stack_desc.BackTrace();
 
 	clib::Memset(ptr_result, GPOS_MEM_INIT_PATTERN_CHAR, bytes);
+#else
+	// debug builds keep every allocation in the allocation list,
+	// so that leaks can be reported with their origin
+	if (GPOS_MEM_MAGAZINE_THRESHOLD == header->m_serial)
+	{
+		CreateMagazines();
+	}
 #endif // GPOS_DEBUG
 
 	return ptr_result;
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolTracker::CreateMagazines
+//
+//	@doc:
+//		Serve small allocations of unbounded pools from per-thread magazines;
+//		magazine blocks are not linked into the allocation list, they are
+//		released with their chunks when the pool is torn down
+//
+//---------------------------------------------------------------------------
+void
+CMemoryPoolTracker::CreateMagazines()
+{
+	GPOS_ASSERT(NULL == m_magazine_cache);
+
+	ITask *task = ITask::Self();
+	if (gpos::ullong_max != m_capacity ||
+		(NULL != task && task->IsTraceSet(EtraceDisableMemoryMagazines)))
+	{
+		return;
+	}
+
+	// like magazine chunks, the magazine cache is not accounted for in the
+	// pool's statistics
+	void *ptr = GetUnderlyingMemoryPool()->Allocate(GPOS_SIZEOF(SMagazineCache), __FILE__, __LINE__);
+	if (NULL == ptr)
+	{
+		return;
+	}
+
+	SMagazineCache *magazine_cache = new(ptr) SMagazineCache();
+
+	// publish magazines after they are fully constructed
+	if (!CompareSwap
+			(
+			reinterpret_cast<volatile ULONG_PTR*>(&m_magazine_cache),
+			(ULONG_PTR) NULL,
+			reinterpret_cast<ULONG_PTR>(magazine_cache)
+			))
+	{
+		magazine_cache->~SMagazineCache();
+		GetUnderlyingMemoryPool()->Free(ptr);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolTracker::GetMagazineSlot
+//
+//	@doc:
+//		Find magazine slot of the calling thread
+//
+//---------------------------------------------------------------------------
+CMemoryPoolTracker::SMagazineSlot &
+CMemoryPoolTracker::GetMagazineSlot()
+{
+	GPOS_ASSERT(NULL != m_magazine_cache);
+
+	if (!IsThreadSafe())
+	{
+		return m_magazine_cache->m_slots[0];
+	}
+
+	CWorkerId wid;
+	return m_magazine_cache->m_slots[CWorkerId::HashValue(wid) % GPOS_MEM_MAGAZINE_SLOTS];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolTracker::AllocateFromMagazine
+//
+//	@doc:
+//		Allocate block of the size class of the request from the magazine
+//		of the calling thread
+//
+//---------------------------------------------------------------------------
+void *
+CMemoryPoolTracker::AllocateFromMagazine
+	(
+	ULONG bytes,
+	const CHAR *file,
+	ULONG line
+	)
+{
+	GPOS_ASSERT(FUseMagazine(bytes));
+
+	const ULONG size_class = GPOS_MEM_MAGAZINE_CLASS(bytes);
+
+	SMagazineSlot &slot = GetMagazineSlot();
+	SAllocHeader *header = NULL;
+
+	// scope indicating locking
+	{
+		CAutoSpinlock as(slot.m_lock);
+		SLock(as);
+
+		SMagazine &magazine = slot.m_magazines[size_class];
+		if (NULL == magazine.m_top && !RefillMagazine(magazine, size_class))
+		{
+			SUnlock(as);
+
+			CAutoSpinlock asPool(m_lock);
+			SLock(asPool);
+			m_memory_pool_statistics.RecordFailedAllocation();
+
+			return NULL;
+		}
+
+		header = magazine.Pop();
+
+		slot.m_num_allocations++;
+		slot.m_alloc_user_size += bytes;
+		slot.m_alloc_total_size += GPOS_MEM_BYTES_TOTAL(bytes);
+
+		if (GPOS_MEM_MAGAZINE_STATS_INTERVAL <= ++slot.m_num_ops)
+		{
+			AggregateStatistics(slot);
+		}
+	}
+
+	header->m_serial = 0;
+	header->m_filename = file;
+	header->m_line = line;
+	header->m_size = bytes;
+	header->m_magazine = true;
+
+	return header + 1;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolTracker::RefillMagazine
+//
+//	@doc:
+//		Refill an empty magazine with a batch of blocks, taken from the depot
+//		if available, or carved from a new chunk of the underlying pool;
+//		caller must hold the magazine's slot lock
+//
+//---------------------------------------------------------------------------
+BOOL
+CMemoryPoolTracker::RefillMagazine
+	(
+	SMagazine &magazine,
+	ULONG size_class
+	)
+{
+	GPOS_ASSERT(NULL == magazine.m_top);
+
+	// scope indicating locking
+	{
+		CAutoSpinlock as(m_lock);
+		SLock(as);
+
+		SMagazine &depot = m_magazine_cache->m_depot[size_class];
+		for (ULONG ul = 0; ul < GPOS_MEM_MAGAZINE_BATCH && NULL != depot.m_top; ul++)
+		{
+			magazine.Push(depot.Pop());
+		}
+
+		if (NULL != magazine.m_top)
+		{
+			return true;
+		}
+	}
+
+	const ULONG block_size = GPOS_MEM_ALLOC_HEADER_SIZE + (size_class + 1) * GPOS_MEM_ARCH;
+	GPOS_ASSERT(MAX_ALIGNED(block_size));
+
+	SLink *chunk = static_cast<SLink*>
+			(
+			GetUnderlyingMemoryPool()->Allocate
+				(
+				GPOS_MEM_MAGAZINE_CHUNK_HEADER_SIZE + GPOS_MEM_MAGAZINE_BATCH * block_size,
+				__FILE__,
+				__LINE__
+				)
+			);
+
+	if (NULL == chunk)
+	{
+		return false;
+	}
+
+	chunk->m_next = NULL;
+	chunk->m_prev = NULL;
+
+	for (ULONG ul = 0; ul < GPOS_MEM_MAGAZINE_BATCH; ul++)
+	{
+		void *block = GPOS_MEM_OFFSET_POS(chunk, GPOS_MEM_MAGAZINE_CHUNK_HEADER_SIZE + ul * block_size);
+		magazine.Push(static_cast<SAllocHeader*>(block));
+	}
+
+	// keep track of new chunk
+	CAutoSpinlock as(m_lock);
+	SLock(as);
+	m_magazine_cache->m_chunks.Append(chunk);
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolTracker::FreeToMagazine
+//
+//	@doc:
+//		Return block to the magazine of the calling thread; a batch of blocks
+//		is moved to the depot when the magazine is full
+//
+//---------------------------------------------------------------------------
+void
+CMemoryPoolTracker::FreeToMagazine
+	(
+	SAllocHeader *header
+	)
+{
+	GPOS_ASSERT(NULL != m_magazine_cache);
+	GPOS_ASSERT(header->m_magazine);
+
+	const ULONG user_size = header->m_size;
+
+	const ULONG size_class = GPOS_MEM_MAGAZINE_CLASS(user_size);
+
+	SMagazineSlot &slot = GetMagazineSlot();
+
+	CAutoSpinlock as(slot.m_lock);
+	SLock(as);
+
+	SMagazine &magazine = slot.m_magazines[size_class];
+	magazine.Push(header);
+
+	if (GPOS_MEM_MAGAZINE_CAPACITY < magazine.m_size)
+	{
+		CAutoSpinlock asPool(m_lock);
+		SLock(asPool);
+
+		SMagazine &depot = m_magazine_cache->m_depot[size_class];
+		for (ULONG ul = 0; ul < GPOS_MEM_MAGAZINE_BATCH; ul++)
+		{
+			depot.Push(magazine.Pop());
+		}
+	}
+
+	slot.m_num_free++;
+	slot.m_free_user_size += user_size;
+	slot.m_free_total_size += GPOS_MEM_BYTES_TOTAL(user_size);
+
+	if (GPOS_MEM_MAGAZINE_STATS_INTERVAL <= ++slot.m_num_ops)
+	{
+		AggregateStatistics(slot);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolTracker::AggregateStatistics
+//
+//	@doc:
+//		Move pending statistics of a slot into the pool's statistics;
+//		caller must hold the slot lock
+//
+//---------------------------------------------------------------------------
+void
+CMemoryPoolTracker::AggregateStatistics
+	(
+	SMagazineSlot &slot
+	)
+{
+	CAutoSpinlock as(m_lock);
+	SLock(as);
+
+	m_memory_pool_statistics.RecordAllocations(slot.m_num_allocations, slot.m_alloc_user_size, slot.m_alloc_total_size);
+	m_memory_pool_statistics.RecordFrees(slot.m_num_free, slot.m_free_user_size, slot.m_free_total_size);
+
+	slot.m_num_ops = 0;
+	slot.m_num_allocations = 0;
+	slot.m_alloc_user_size = 0;
+	slot.m_alloc_total_size = 0;
+	slot.m_num_free = 0;
+	slot.m_free_user_size = 0;
+	slot.m_free_total_size = 0;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolTracker::TotalAllocatedSize
+//
+//	@doc:
+//		Return total allocated size, including statistics of magazine
+//		slots that are not aggregated yet
+//
+//---------------------------------------------------------------------------
+ULLONG
+CMemoryPoolTracker::TotalAllocatedSize() const
+{
+	ULLONG total_size = m_memory_pool_statistics.TotalAllocatedSize();
+
+	const SMagazineCache *magazine_cache = m_magazine_cache;
+	if (NULL != magazine_cache)
+	{
+		for (ULONG ul = 0; ul < GPOS_MEM_MAGAZINE_SLOTS; ul++)
+		{
+			const SMagazineSlot &slot = magazine_cache->m_slots[ul];
+			total_size += slot.m_alloc_total_size;
+			total_size -= slot.m_free_total_size;
+		}
+	}
+
+	return total_size;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemoryPoolTracker::Reserve
@@ -233,9 +589,15 @@ CMemoryPoolTracker::Free
 	void *ptr
 	)
 {
+	SAllocHeader *header = static_cast<SAllocHeader*>(ptr) - 1;
+	if (header->m_magazine)
+	{
+		FreeToMagazine(header);
+		return;
+	}
+
 	CAutoSpinlock as(m_lock);
 
-	SAllocHeader *header = static_cast<SAllocHeader*>(ptr) - 1;
 	ULONG user_size = header->m_size;
 
 #ifdef GPOS_DEBUG
@@ -283,6 +645,8 @@ CMemoryPoolTracker::Free
 void
 CMemoryPoolTracker::TearDown()
 {
+	ReleaseMagazines();
+
 	while (!m_allocations_list.IsEmpty())
 	{
 		SAllocHeader *header = m_allocations_list.First();
@@ -294,6 +658,36 @@ CMemoryPoolTracker::TearDown()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolTracker::ReleaseMagazines
+//
+//	@doc:
+//		Return magazine chunks and the magazine cache to the underlying pool;
+//		this releases all blocks served from magazines
+//
+//---------------------------------------------------------------------------
+void
+CMemoryPoolTracker::ReleaseMagazines()
+{
+	SMagazineCache *magazine_cache = m_magazine_cache;
+	if (NULL == magazine_cache)
+	{
+		return;
+	}
+
+	m_magazine_cache = NULL;
+
+	while (!magazine_cache->m_chunks.IsEmpty())
+	{
+		GetUnderlyingMemoryPool()->Free(magazine_cache->m_chunks.RemoveHead());
+	}
+
+	magazine_cache->~SMagazineCache();
+	GetUnderlyingMemoryPool()->Free(magazine_cache);
+}
+
+
 #ifdef GPOS_DEBUG
 
 //---------------------------------------------------------------------------
@@ -77,7 +77,39 @@ namespace gpdxl
 				const CHAR *xsd_file_path
 				);
 			
+			// serialize a DXL query tree using the given serializer
+			static
+			void SerializeQuery
+				(
+				IMemoryPool *mp,
+				CXMLSerializer *xml_serializer,
+				const CDXLNode *dxl_query_node,
+				const CDXLNodeArray *query_output_dxlnode_array,
+				const CDXLNodeArray *cte_producers,
+				BOOL serialize_document_header_footer
+				);
 
+			// serialize a plan using the given serializer
+			static
+			void SerializePlan
+				(
+				IMemoryPool *mp,
+				CXMLSerializer *xml_serializer,
+				const CDXLNode *node,
+				ULLONG plan_id,
+				ULLONG plan_space_size,
+				BOOL serialize_document_header_footer
+				);
+
+			// serialize metadata objects using the given serializer
+			static
+			void SerializeMetadata
+				(
+				IMemoryPool *mp,
+				const IMDCacheObjectArray *imd_obj_array,
+				CXMLSerializer *xml_serializer,
+				BOOL serialize_document_header_footer
+				);
 
 		public:
 			// helper functions for serializing DXL document header and footer, respectively
@@ -103,6 +135,94 @@ namespace gpdxl
 				const CHAR *xsd_file_path
 				);
 
+			// parse a binary DXL document and return the top-level parse handler
+			static
+			CParseHandlerDXL *GetParseHandlerForBinaryDXL
+				(
+				IMemoryPool *,
+				const BYTE *data,
+				ULONG size
+				);
+
+			// parse a binary DXL document containing a DXL plan
+			static
+			CDXLNode *ParseBinaryDXLToPlan
+				(
+				IMemoryPool *,
+				const BYTE *data,
+				ULONG size,
+				ULLONG *plan_id,
+				ULLONG *plan_space_size
+				);
+
+			// parse a binary DXL document representing a query
+			static
+			CQueryToDXLResult *ParseBinaryDXLToQuery
+				(
+				IMemoryPool *,
+				const BYTE *data,
+				ULONG size
+				);
+
+			// parse a list of metadata objects from a binary DXL document
+			static
+			IMDCacheObjectArray *ParseBinaryDXLToIMDObjectArray
+				(
+				IMemoryPool *,
+				const BYTE *data,
+				ULONG size
+				);
+
+			// serialize a DXL query tree into a binary DXL document
+			static
+			BYTE *SerializeQueryToBinary
+				(
+				IMemoryPool *mp,
+				const CDXLNode *dxl_query_node,
+				const CDXLNodeArray *query_output_dxlnode_array,
+				const CDXLNodeArray *cte_producers,
+				ULONG *size
+				);
+
+			// serialize a plan into a binary DXL document
+			static
+			BYTE *SerializePlanToBinary
+				(
+				IMemoryPool *mp,
+				const CDXLNode *node,
+				ULLONG plan_id,
+				ULLONG plan_space_size,
+				ULONG *size
+				);
+
+			// serialize metadata objects into a binary DXL document
+			static
+			BYTE *SerializeMetadataToBinary
+				(
+				IMemoryPool *mp,
+				const IMDCacheObjectArray *imd_obj_array,
+				ULONG *size
+				);
+
+			// convert a DXL document into a binary DXL document
+			static
+			BYTE *ConvertDXLToBinary
+				(
+				IMemoryPool *mp,
+				const CHAR *dxl_string,
+				ULONG *size
+				);
+
+			// convert a binary DXL document into a DXL document
+			static
+			CWStringDynamic *ConvertBinaryToDXL
+				(
+				IMemoryPool *mp,
+				const BYTE *data,
+				ULONG size,
+				BOOL indentation
+				);
+
 			// parse a DXL document containing a DXL plan
 			static 
 			CDXLNode *GetPlanDXLNode
@@ -194,6 +314,14 @@ namespace gpdxl
 				const CHAR *xsd_file_path
 				);
 
+			static
+			IMDCacheObject *ParseDXLToIMDIdCacheObj
+				(
+				IMemoryPool *,
+				const CHAR *dxl_string,
+				const CHAR *xsd_file_path
+				);
+
 			// parse statistics object from the statistics document
 			static 
 			CDXLStatsDerivedRelationArray *ParseDXLToStatsDerivedRelArray
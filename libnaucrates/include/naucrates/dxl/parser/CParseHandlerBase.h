@@ -42,6 +42,7 @@ namespace gpdxl
 		EdxlphStatisticsConfig,
 		EdxlphCTEConfig,
 		EdxlphHint,
+		EdxlphSchedulerConfig,
 		EdxlphWindowOids,
 		EdxlphTraceFlags,
 		EdxlphPlan,
@@ -171,6 +171,15 @@ namespace gpdxl
 				CParseHandlerBase *parse_handler_root
 				);
 
+			// construct scheduler configuration parse handler
+			static
+			CParseHandlerBase *CreateSchedulerCfgParseHandler
+				(
+				IMemoryPool *mp,
+				CParseHandlerManager *parse_handler_mgr,
+				CParseHandlerBase *parse_handler_root
+				);
+
 			// construct window oids parse handler
 			static
 			CParseHandlerBase *CreateWindowOidsParseHandler
@@ -28,6 +28,7 @@ namespace gpdxl
 	// fwd decl
 	class CParseHandlerPhysicalOp;
 	class CDXLMemoryManager;
+	class CDXLBinaryReader;
 	
 	// stack of parse handlers
 	typedef CStack<CParseHandlerBase> ParseHandlerStack;
@@ -51,6 +52,9 @@ namespace gpdxl
 			
 			// parser object responsible for parsing the current XML document
 			SAX2XMLReader *m_xml_reader;
+
+			// reader of the current binary DXL document, if the document is not XML
+			CDXLBinaryReader *m_binary_reader;
 			
 			// current parse handler
 			CParseHandlerBase *m_curr_parse_handler;
@@ -64,6 +68,9 @@ namespace gpdxl
 			// check for aborts at regular intervals
 			void CheckForAborts();
 
+			// direct the events of the current document to the given handler
+			void SetContentHandler(CParseHandlerBase *parse_handler_base);
+
 			// private copy ctor
 			CParseHandlerManager(const CParseHandlerManager &);
 			
@@ -71,6 +78,7 @@ namespace gpdxl
 		public:
 			// ctor/dtor
 			CParseHandlerManager(CDXLMemoryManager *, SAX2XMLReader *);
+			CParseHandlerManager(CDXLMemoryManager *, CDXLBinaryReader *);
 			~CParseHandlerManager();
 			
 			
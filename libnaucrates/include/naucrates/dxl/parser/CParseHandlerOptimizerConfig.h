@@ -44,6 +44,9 @@ namespace gpdxl
 		
 			// optimizer configuration
 			COptimizerConfig *m_optimizer_config;
+
+			// optimization budget in milliseconds
+			ULONG m_ulOptimizationBudget;
 			
 			// private copy ctor
 			CParseHandlerOptimizerConfig(const CParseHandlerOptimizerConfig&); 
@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CParseHandlerSchedulerConfig.h
+//
+//	@doc:
+//		SAX parse handler class for parsing scheduler configuration
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CParseHandlerSchedulerConfig_H
+#define GPDXL_CParseHandlerSchedulerConfig_H
+
+#include "gpos/base.h"
+#include "naucrates/dxl/parser/CParseHandlerBase.h"
+#include "gpopt/engine/CSchedulerConfig.h"
+
+namespace gpdxl
+{
+	using namespace gpos;
+
+	XERCES_CPP_NAMESPACE_USE
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CParseHandlerSchedulerConfig
+	//
+	//	@doc:
+	//		SAX parse handler class for parsing scheduler configuration options
+	//
+	//---------------------------------------------------------------------------
+	class CParseHandlerSchedulerConfig : public CParseHandlerBase
+	{
+		private:
+
+			// scheduler configuration
+			CSchedulerConfig *m_sched_conf;
+
+			// private copy ctor
+			CParseHandlerSchedulerConfig(const CParseHandlerSchedulerConfig&);
+
+			// process the start of an element
+			void StartElement
+				(
+					const XMLCh* const element_uri, 		// URI of element's namespace
+ 					const XMLCh* const element_local_name,	// local part of element's name
+					const XMLCh* const element_qname,		// element's qname
+					const Attributes& attr				// element's attributes
+				);
+
+			// process the end of an element
+			void EndElement
+				(
+					const XMLCh* const element_uri, 		// URI of element's namespace
+					const XMLCh* const element_local_name,	// local part of element's name
+					const XMLCh* const element_qname		// element's qname
+				);
+
+			// parse the scheduling policy from the attribute value
+			static
+			CSchedulerConfig::ESchedulingPolicy ParseSchedulingPolicy(const XMLCh *policy_xml);
+
+			// parse the worker policy from the attribute value
+			static
+			CSchedulerConfig::EWorkerPolicy ParseWorkerPolicy(const XMLCh *policy_xml);
+
+		public:
+			// ctor
+			CParseHandlerSchedulerConfig
+				(
+				IMemoryPool *mp,
+				CParseHandlerManager *parse_handler_mgr,
+				CParseHandlerBase *parse_handler_root
+				);
+
+			// dtor
+			virtual
+			~CParseHandlerSchedulerConfig();
+
+			// type of the parse handler
+			virtual
+			EDxlParseHandlerType GetParseHandlerType() const;
+
+			// scheduler configuration
+			CSchedulerConfig *GetSchedulerConf() const;
+	};
+}
+
+#endif // !GPDXL_CParseHandlerSchedulerConfig_H
+
+// EOF
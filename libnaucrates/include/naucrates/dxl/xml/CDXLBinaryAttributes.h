@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLBinaryAttributes.h
+//
+//	@doc:
+//		SAX attribute list of an element read from a binary DXL document
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CDXLBinaryAttributes_H
+#define GPDXL_CDXLBinaryAttributes_H
+
+#include "gpos/base.h"
+
+#include <xercesc/sax2/Attributes.hpp>
+
+namespace gpdxl
+{
+	using namespace gpos;
+
+	XERCES_CPP_NAMESPACE_USE
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CDXLBinaryAttributes
+	//
+	//	@doc:
+	//		Attribute list handed to parse handlers by the binary DXL reader.
+	//		Names and values point into the binary document; names are
+	//		unprefixed and have no namespace URI.
+	//
+	//---------------------------------------------------------------------------
+	class CDXLBinaryAttributes : public Attributes
+	{
+		private:
+
+			// memory pool
+			IMemoryPool *m_mp;
+
+			// attribute names
+			const XMLCh **m_names;
+
+			// attribute values
+			const XMLCh **m_values;
+
+			// number of attributes
+			ULONG m_size;
+
+			// size of name and value arrays
+			ULONG m_capacity;
+
+			// private copy ctor
+			CDXLBinaryAttributes(const CDXLBinaryAttributes &);
+
+			// position of attribute with the given name, gpos::ulong_max if not found
+			ULONG Find(const XMLCh *name) const;
+
+		public:
+
+			// ctor
+			explicit
+			CDXLBinaryAttributes(IMemoryPool *mp);
+
+			// dtor
+			virtual
+			~CDXLBinaryAttributes();
+
+			// remove all attributes
+			void Clear()
+			{
+				m_size = 0;
+			}
+
+			// add attribute
+			void Append(const XMLCh *name, const XMLCh *value);
+
+			// Attributes interface
+			virtual
+			XMLSize_t getLength() const;
+
+			virtual
+			const XMLCh *getURI(const XMLSize_t index) const;
+
+			virtual
+			const XMLCh *getLocalName(const XMLSize_t index) const;
+
+			virtual
+			const XMLCh *getQName(const XMLSize_t index) const;
+
+			virtual
+			const XMLCh *getType(const XMLSize_t index) const;
+
+			virtual
+			const XMLCh *getValue(const XMLSize_t index) const;
+
+			virtual
+			bool getIndex(const XMLCh *const uri, const XMLCh *const local_part, XMLSize_t &index) const;
+
+			virtual
+			int getIndex(const XMLCh *const uri, const XMLCh *const local_part) const;
+
+			virtual
+			bool getIndex(const XMLCh *const qname, XMLSize_t &index) const;
+
+			virtual
+			int getIndex(const XMLCh *const qname) const;
+
+			virtual
+			const XMLCh *getType(const XMLCh *const uri, const XMLCh *const local_part) const;
+
+			virtual
+			const XMLCh *getType(const XMLCh *const qname) const;
+
+			virtual
+			const XMLCh *getValue(const XMLCh *const qname) const;
+
+			virtual
+			const XMLCh *getValue(const XMLCh *const uri, const XMLCh *const local_part) const;
+
+	}; // class CDXLBinaryAttributes
+}
+
+#endif // !GPDXL_CDXLBinaryAttributes_H
+
+// EOF
@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLBinaryReader.h
+//
+//	@doc:
+//		Reader of binary DXL documents
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CDXLBinaryReader_H
+#define GPDXL_CDXLBinaryReader_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/xml/CDXLBinaryAttributes.h"
+
+#include <xercesc/sax2/ContentHandler.hpp>
+
+namespace gpdxl
+{
+	using namespace gpos;
+
+	XERCES_CPP_NAMESPACE_USE
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CDXLBinaryReader
+	//
+	//	@doc:
+	//		Reads a document written by CDXLBinarySerializer and replays it as
+	//		SAX events to a content handler, playing the role the Xerces SAX2
+	//		reader plays for XML documents. The content handler may be
+	//		replaced while events are delivered, as parse handlers do through
+	//		CParseHandlerManager.
+	//
+	//		Strings are not copied: element names, attribute names and values
+	//		handed to the content handler point into the document, which must
+	//		outlive the reader. Elements are reported with the DXL namespace
+	//		URI and their local name as qualified name.
+	//
+	//---------------------------------------------------------------------------
+	class CDXLBinaryReader
+	{
+		private:
+
+			// memory pool
+			IMemoryPool *m_mp;
+
+			// document
+			const BYTE *m_buffer;
+
+			// size of document
+			ULONG m_size;
+
+			// copy of the document, if the given one was misaligned
+			BYTE *m_aligned_buffer;
+
+			// current read position
+			ULONG m_offset;
+
+			// receiver of SAX events
+			ContentHandler *m_content_handler;
+
+			// names defined so far, indexed by their reference minus one
+			const XMLCh **m_names;
+
+			// number of names defined so far
+			ULONG m_num_names;
+
+			// size of name table
+			ULONG m_names_capacity;
+
+			// names of open elements
+			const XMLCh **m_elements;
+
+			// number of open elements
+			ULONG m_depth;
+
+			// size of element stack
+			ULONG m_elements_capacity;
+
+			// attributes of the current element
+			CDXLBinaryAttributes m_attrs;
+
+			// private copy ctor
+			CDXLBinaryReader(const CDXLBinaryReader &);
+
+			// raise a parse error at the current read position
+			void RaiseError() const;
+
+			// read raw byte
+			BYTE ReadByte();
+
+			// read variable-length integer
+			ULONG ReadVarint();
+
+			// read string in place
+			const XMLCh *ReadString();
+
+			// read name reference, defining the name if it is new
+			const XMLCh *ReadName();
+
+			// append to an array of names, growing it if needed
+			void Append(const XMLCh ***names, ULONG *size, ULONG *capacity, const XMLCh *name);
+
+			// read attributes following a start element record
+			void ReadAttributes();
+
+		public:
+
+			// ctor
+			CDXLBinaryReader(IMemoryPool *mp, const BYTE *buffer, ULONG size);
+
+			// dtor
+			~CDXLBinaryReader();
+
+			// set the receiver of SAX events
+			void SetContentHandler(ContentHandler *content_handler)
+			{
+				m_content_handler = content_handler;
+			}
+
+			// read the whole document and deliver its events
+			void Parse();
+
+			// does the given buffer start with a binary DXL header
+			static
+			BOOL IsBinaryDXL(const BYTE *buffer, ULONG size);
+
+	}; // class CDXLBinaryReader
+}
+
+#endif // !GPDXL_CDXLBinaryReader_H
+
+// EOF
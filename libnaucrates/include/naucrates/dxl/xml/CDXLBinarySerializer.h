@@ -0,0 +1,201 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLBinarySerializer.h
+//
+//	@doc:
+//		Serializer for binary DXL documents
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CDXLBinarySerializer_H
+#define GPDXL_CDXLBinarySerializer_H
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/io/COstreamString.h"
+#include "gpos/string/CWStringConst.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+// magic number at the beginning of binary DXL documents
+#define GPDXL_BINARY_MAGIC 0x42584444
+
+// current format version of binary DXL documents
+#define GPDXL_BINARY_VERSION 1
+
+namespace gpdxl
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CDXLBinarySerializer
+	//
+	//	@doc:
+	//		Serializer that encodes the element and attribute events of a DXL
+	//		document in a compact binary form instead of XML text.
+	//
+	//		A document starts with a header holding magic number and version,
+	//		followed by a sequence of records, each introduced by a record tag:
+	//		start of element, attribute of the last started element, end of
+	//		element and end of document. Element and attribute names are
+	//		written out once per document and referenced by their index
+	//		afterwards; name references and string lengths are variable-length
+	//		integers. Strings are stored as aligned, NUL-terminated XMLCh
+	//		arrays so that a reader can hand them to parse handlers in place.
+	//
+	//		Element names are local names in the DXL namespace; namespace
+	//		declarations are implied and not written.
+	//
+	//---------------------------------------------------------------------------
+	class CDXLBinarySerializer : public CXMLSerializer
+	{
+		public:
+
+			// record tags
+			enum ERecord
+			{
+				ErecStartElement = 1,
+				ErecAttribute,
+				ErecEndElement,
+				ErecEndDocument
+			};
+
+		private:
+
+			// hash function of names
+			static
+			ULONG HashName(const CWStringConst *str);
+
+			// equality function of names
+			static
+			BOOL EqualsName(const CWStringConst *str_fst, const CWStringConst *str_snd);
+
+			// map of names to their index in the document's name table
+			typedef CHashMap<CWStringConst, ULONG, HashName, EqualsName,
+						CleanupDelete<CWStringConst>, CleanupDelete<ULONG> > NameToIndexMap;
+
+			// memory pool
+			IMemoryPool *m_mp;
+
+			// scratch string and stream for formatting attribute values; the
+			// base class only keeps a reference to the stream
+			CWStringDynamic m_value_str;
+			COstreamString m_value_os;
+
+			// output buffer
+			BYTE *m_buffer;
+
+			// number of bytes written to output buffer
+			ULONG m_size;
+
+			// size of output buffer
+			ULONG m_capacity;
+
+			// names written so far
+			NameToIndexMap *m_names;
+
+			// number of currently open elements
+			ULONG m_depth;
+
+			// private copy ctor
+			CDXLBinarySerializer(const CDXLBinarySerializer&);
+
+			// make room for the given number of bytes
+			void Reserve(ULONG num_bytes);
+
+			// append raw bytes
+			void WriteBytes(const void *data, ULONG num_bytes);
+
+			// append variable-length integer
+			void WriteVarint(ULONG value);
+
+			// append string as NUL-terminated XMLCh array
+			void WriteString(const WCHAR *wsz, ULONG length);
+
+			// append reference to a name, writing the name if it is new
+			void WriteName(const CWStringBase *str);
+
+			// append attribute with a value formatted in the scratch string
+			void WriteFormattedAttribute(const CWStringBase *pstrAttr);
+
+		public:
+
+			// ctor
+			explicit
+			CDXLBinarySerializer(IMemoryPool *mp);
+
+			// dtor
+			virtual
+			~CDXLBinarySerializer();
+
+			// serialized document
+			const BYTE *GetBuffer() const
+			{
+				return m_buffer;
+			}
+
+			// size of serialized document
+			ULONG Size() const
+			{
+				return m_size;
+			}
+
+			// copy of serialized document allocated in the given memory pool
+			BYTE *CopyBuffer(IMemoryPool *mp) const;
+
+			// binary documents have no XML declaration
+			virtual
+			void StartDocument();
+
+			// finish the document; no further elements may be written
+			void EndDocument();
+
+			// opens a new element with the given name
+			virtual
+			void OpenElement(const CWStringBase *pstrNamespace, const CWStringBase *elem_str);
+
+			// closes the element with the given name
+			virtual
+			void CloseElement(const CWStringBase *pstrNamespace, const CWStringBase *elem_str);
+
+			// adds a string-valued attribute; namespace declarations are skipped
+			virtual
+			void AddAttribute(const CWStringBase *pstrAttr, const CWStringBase *str_value);
+
+			// adds a character string attribute
+			virtual
+			void AddAttribute(const CWStringBase *pstrAttr, const CHAR *szValue);
+
+			// adds an unsigned integer-valued attribute
+			virtual
+			void AddAttribute(const CWStringBase *pstrAttr, ULONG ulValue);
+
+			// adds an unsigned long integer attribute
+			virtual
+			void AddAttribute(const CWStringBase *pstrAttr, ULLONG ullValue);
+
+			// adds an integer-valued attribute
+			virtual
+			void AddAttribute(const CWStringBase *pstrAttr, INT iValue);
+
+			// adds an integer-valued attribute
+			virtual
+			void AddAttribute(const CWStringBase *pstrAttr, LINT value);
+
+			// add a double-valued attribute
+			virtual
+			void AddAttribute(const CWStringBase *pstrAttr, CDouble value);
+
+			// boolean and byte array attributes are written as strings by the base class
+			using CXMLSerializer::AddAttribute;
+
+	}; // class CDXLBinarySerializer
+}
+
+#endif // !GPDXL_CDXLBinarySerializer_H
+
+// EOF
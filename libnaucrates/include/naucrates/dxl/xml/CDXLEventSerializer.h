@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLEventSerializer.h
+//
+//	@doc:
+//		SAX content handler writing the events it receives to a serializer
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CDXLEventSerializer_H
+#define GPDXL_CDXLEventSerializer_H
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/string/CWStringConst.h"
+
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+namespace gpdxl
+{
+	using namespace gpos;
+
+	XERCES_CPP_NAMESPACE_USE
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CDXLEventSerializer
+	//
+	//	@doc:
+	//		Content handler that writes the elements and attributes of a DXL
+	//		document to a serializer without interpreting them. Installed in a
+	//		Xerces reader with a CDXLBinarySerializer it converts XML documents
+	//		to binary ones; installed in a CDXLBinaryReader with an XML
+	//		serializer it converts binary documents back to XML.
+	//
+	//		Elements are written in the DXL namespace; the namespace is
+	//		declared on the root element and incoming declarations are dropped.
+	//
+	//---------------------------------------------------------------------------
+	class CDXLEventSerializer : public DefaultHandler
+	{
+		private:
+
+			// hash function of names
+			static
+			ULONG HashName(const CWStringConst *str);
+
+			// equality function of names
+			static
+			BOOL EqualsName(const CWStringConst *str_fst, const CWStringConst *str_snd);
+
+			// set of element names; keys and values are the same strings
+			typedef CHashMap<CWStringConst, CWStringConst, HashName, EqualsName,
+						CleanupDelete<CWStringConst>, CleanupNULL<CWStringConst> > NameMap;
+
+			// memory pool
+			IMemoryPool *m_mp;
+
+			// target serializer
+			CXMLSerializer *m_xml_serializer;
+
+			// scratch buffers for converting names and values
+			WCHAR *m_name;
+			ULONG m_name_capacity;
+			WCHAR *m_value;
+			ULONG m_value_capacity;
+
+			// number of currently open elements
+			ULONG m_depth;
+
+			// element names seen so far; the serializer may keep references
+			// to the names of open elements
+			NameMap *m_element_names;
+
+			// private copy ctor
+			CDXLEventSerializer(const CDXLEventSerializer &);
+
+			// convert Xerces string into the given scratch buffer
+			const WCHAR *Convert(const XMLCh *xmlsz, WCHAR **buffer, ULONG *capacity);
+
+			// element name that stays valid for the lifetime of the handler
+			const CWStringConst *GetElementName(const XMLCh *xmlsz);
+
+		public:
+
+			// ctor
+			CDXLEventSerializer(IMemoryPool *mp, CXMLSerializer *xml_serializer);
+
+			// dtor
+			virtual
+			~CDXLEventSerializer();
+
+			// SAX events
+			virtual
+			void startDocument();
+
+			virtual
+			void startElement
+				(
+				const XMLCh *const element_uri,
+				const XMLCh *const element_local_name,
+				const XMLCh *const element_qname,
+				const Attributes &attrs
+				);
+
+			virtual
+			void endElement
+				(
+				const XMLCh *const element_uri,
+				const XMLCh *const element_local_name,
+				const XMLCh *const element_qname
+				);
+
+	}; // class CDXLEventSerializer
+}
+
+#endif // !GPDXL_CDXLEventSerializer_H
+
+// EOF
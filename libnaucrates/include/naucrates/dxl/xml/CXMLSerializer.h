@@ -89,6 +89,7 @@ namespace gpdxl
 				m_strstackElems = GPOS_NEW(m_mp) StrStack(m_mp);
 			}
 			
+			virtual
 			~CXMLSerializer();
 			
 			// get underlying memory pool
@@ -98,39 +99,51 @@ namespace gpdxl
 			}
 
 			// starts an XML document
+			virtual
 			void StartDocument();
 			
 			// opens a new element with the given name
+			virtual
 			void OpenElement(const CWStringBase *pstrNamespace, const CWStringBase *elem_str);
 			
 			// closes the element with the given name
+			virtual
 			void CloseElement(const CWStringBase *pstrNamespace, const CWStringBase *elem_str);
 			
 			// adds a string-valued attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, const CWStringBase *str_value);
 			
 			// adds a character string attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, const CHAR *szValue);
 
 			// adds an unsigned integer-valued attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, ULONG ulValue);
 			
 			// adds an unsigned long integer attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, ULLONG ullValue);
 
 			// adds an integer-valued attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, INT iValue);
 			
 			// adds an integer-valued attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, LINT value);
 
 			// adds a boolean attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, BOOL fValue);
 			
 			// add a double-valued attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, CDouble value);
 
 			// add a byte array attribute
+			virtual
 			void AddAttribute(const CWStringBase *pstrAttr, BOOL is_null, const BYTE *data, ULONG length);
 	};
 	
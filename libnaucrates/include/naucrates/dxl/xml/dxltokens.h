@@ -47,6 +47,7 @@ namespace gpdxl
 		EdxltokenY,
 		
 		EdxltokenOptimizerConfig,
+		EdxltokenOptimizationBudget,
 		EdxltokenEnumeratorConfig,
 		EdxltokenStatisticsConfig,
 		EdxltokenDampingFactorFilter,
@@ -64,6 +65,15 @@ namespace gpdxl
 		EdxltokenJoinOrderDPThreshold,
 		EdxltokenBroadcastThreshold,
 		EdxltokenEnforceConstraintsOnDML,
+		EdxltokenSchedulerConfig,
+		EdxltokenSchedulingPolicy,
+		EdxltokenSchedulingPolicySharedQueue,
+		EdxltokenSchedulingPolicyWorkStealing,
+		EdxltokenSchedulingPolicyPriority,
+		EdxltokenWorkerPolicy,
+		EdxltokenWorkerPolicyQueuedRunningRatio,
+		EdxltokenWorkerPolicyAdaptive,
+		EdxltokenSchedulerWorkers,
 		EdxltokenWindowOids,
 		EdxltokenOidRowNumber,
 		EdxltokenOidRank,
@@ -76,6 +76,9 @@ namespace gpdxl
 		ExmiNoAvailableMemory,
 		ExmiInvalidComparisonTypeCode,
 
+		// binary DXL parsing errors
+		ExmiDXLBinaryParseError,
+
 		ExmiDXLSentinel
 	};
 
@@ -20,10 +20,18 @@ namespace gpopt
 	class CColRef;
 	class CStatisticsConfig;
 	class CColumnFactory;
+	class CMDAccessor;
+}
+
+namespace gpmd
+{
+	class IMDColStats;
 }
 
 namespace gpnaucrates
 {
+	class CHistogramBounds;
+
 	// type definitions
 	// array of doubles
 	typedef CDynamicPtrArray<CDouble, CleanupDelete> CDoubleArray;
@@ -55,8 +63,27 @@ namespace gpnaucrates
 						CleanupDelete<ULONG>, CleanupDelete<CDouble> > UlongToDoubleMapIter;
 
 		private:
-			// all the buckets in the histogram
-		CBucketArray *m_histogram_buckets;
+			// all the buckets in the histogram; for histograms over column statistics
+			// this is NULL until a bucket is accessed for the first time
+			mutable
+			CBucketArray *m_histogram_buckets;
+
+			// memory pool for materializing buckets
+			IMemoryPool *m_mp;
+
+			// metadata accessor, column type and column statistics the buckets
+			// are materialized from, if any; the type and statistics belong to
+			// cached objects the accessor keeps alive
+			CMDAccessor *m_md_accessor;
+
+			IMDId *m_mdid_type;
+
+			const IMDColStats *m_md_col_stats;
+
+			// packed bucket bounds for binary searching the buckets; NULL until
+			// a filter searches the histogram for the first time
+			mutable
+			CHistogramBounds *m_bounds;
 
 			// well-defined histogram. if false, then bounds are unknown
 			BOOL m_is_well_defined;
@@ -124,6 +151,23 @@ namespace gpnaucrates
 			// accessor for n-th bucket
 			CBucket *operator [] (ULONG) const;
 
+			// buckets of the histogram, materializing them if needed
+			CBucketArray *GetBuckets() const
+			{
+				if (NULL == m_histogram_buckets)
+				{
+					MaterializeBuckets();
+				}
+
+				return m_histogram_buckets;
+			}
+
+			// construct the buckets from the column statistics
+			void MaterializeBuckets() const;
+
+			// index of the first bucket the point is not after
+			ULONG GetFirstBucketIndex(IMemoryPool *mp, const CPoint *point) const;
+
 			// compute skew estimate
 			void ComputeSkew();
 
@@ -193,6 +237,16 @@ namespace gpnaucrates
 					BOOL is_col_stats_missing = false
 					);
 
+			// ctor for a histogram whose buckets are constructed from the given
+			// column statistics when first accessed
+			CHistogram
+					(
+					IMemoryPool *mp,
+					CMDAccessor *md_accessor,
+					IMDId *mdid_type,
+					const IMDColStats *md_col_stats
+					);
+
 			// set null frequency
 			void SetNullFrequency(CDouble null_freq);
 
@@ -364,15 +418,18 @@ namespace gpnaucrates
 				const;
 
 			// number of buckets
-			ULONG Buckets() const
-			{
-				return m_histogram_buckets->Size();
-			}
+			ULONG Buckets() const;
 
 			// buckets accessor
 			const CBucketArray *ParseDXLToBucketsArray() const
 			{
-				return m_histogram_buckets;
+				return GetBuckets();
+			}
+
+			// have the buckets been constructed
+			BOOL IsMaterialized() const
+			{
+				return NULL != m_histogram_buckets;
 			}
 
 			// well defined
@@ -405,10 +462,7 @@ namespace gpnaucrates
 
 			// destructor
 			virtual
-			~CHistogram()
-			{
-				m_histogram_buckets->Release();
-			}
+			~CHistogram();
 
 			// normalize histogram and return scaling factor
 			CDouble NormalizeHistogram();
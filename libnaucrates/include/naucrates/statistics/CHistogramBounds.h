@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CHistogramBounds.h
+//
+//	@doc:
+//		Packed upper bounds of histogram buckets
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CHistogramBounds_H
+#define GPNAUCRATES_CHistogramBounds_H
+
+#include "gpos/base.h"
+#include "gpos/common/CRefCount.h"
+
+#include "naucrates/statistics/CBucket.h"
+
+namespace gpnaucrates
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CHistogramBounds
+	//
+	//	@doc:
+	//		Upper bounds of the buckets of a histogram, stored in parallel arrays
+	//		of their statistics mappings, so that the bucket a point falls into
+	//		can be found by binary search instead of comparing datums bucket by
+	//		bucket.
+	//
+	//		Bounds are only packed if all of them are of the same type and map
+	//		to double, and the buckets are ordered; comparisons of packed values
+	//		give the same results as comparisons of the datums they come from.
+	//
+	//---------------------------------------------------------------------------
+	class CHistogramBounds : public CRefCount
+	{
+		private:
+
+			// memory pool
+			IMemoryPool *m_mp;
+
+			// number of buckets; zero if the bounds could not be packed
+			ULONG m_num_buckets;
+
+			// are bounds compared by their LINT mapping, otherwise by their double mapping
+			BOOL m_is_lint_mapped;
+
+			// LINT mappings of upper bounds
+			LINT *m_upper_lint;
+
+			// double mappings of upper bounds
+			DOUBLE *m_upper_double;
+
+			// closedness of upper bounds
+			BOOL *m_is_upper_closed;
+
+			// datum of the first bound, used to check if points can be searched
+			IDatum *m_datum;
+
+			// private copy ctor
+			CHistogramBounds(const CHistogramBounds &);
+
+			// pack the bounds of the given buckets; return false if they cannot be packed
+			BOOL Pack(const CBucketArray *buckets);
+
+			// is the point after the upper bound of the given bucket
+			BOOL IsAfter(ULONG bucket_index, LINT value) const;
+
+			BOOL IsAfter(ULONG bucket_index, CDouble value) const;
+
+		public:
+
+			// ctor
+			CHistogramBounds(IMemoryPool *mp, const CBucketArray *buckets);
+
+			// dtor
+			virtual
+			~CHistogramBounds();
+
+			// could the bounds be packed
+			BOOL IsPacked() const
+			{
+				return 0 < m_num_buckets;
+			}
+
+			// can the buckets containing the given point be searched for
+			BOOL CanSearch(const CPoint *point) const;
+
+			// index of the first bucket the point is not after; the number of
+			// buckets if the point is after all of them
+			ULONG GetBucketIndex(const CPoint *point) const;
+
+	}; // class CHistogramBounds
+}
+
+#endif // !GPNAUCRATES_CHistogramBounds_H
+
+// EOF
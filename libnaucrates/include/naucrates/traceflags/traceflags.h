@@ -177,6 +177,10 @@ namespace gpos
 
 		// Eager Agg 
 		EopttraceEnableEagerAgg = 103030,
+
+		// enumerate connected subset pairs in DP join ordering regardless of the number of components
+		EopttraceForceConnectedSubgraphJoinOrderDP = 103031,
+
 		///////////////////////////////////////////////////////
 		///////////////////// statistics flags ////////////////
 		//////////////////////////////////////////////////////
@@ -199,6 +203,12 @@ namespace gpos
 		// Always pick plans that split scalar DQA into a plan with 3-stage aggregation
 		EopttraceForceThreeStageScalarDQA = 104005,
 
+		// construct the histogram buckets of base table columns upfront instead of on first use
+		EopttraceEagerHistogramMaterialization = 104006,
+
+		// scan histogram buckets linearly instead of binary searching their packed bounds
+		EopttraceDisableHistogramBoundsSearch = 104007,
+
 		///////////////////////////////////////////////////////
 		/////////// constant expression evaluator flags ///////
 		///////////////////////////////////////////////////////
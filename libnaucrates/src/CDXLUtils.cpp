@@ -33,6 +33,9 @@
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
 #include "naucrates/dxl/parser/CParseHandlerDummy.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+#include "naucrates/dxl/xml/CDXLBinarySerializer.h"
+#include "naucrates/dxl/xml/CDXLEventSerializer.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "gpopt/mdcache/CMDAccessor.h"
@@ -305,6 +308,44 @@ CDXLUtils::GetParseHandlerForDXLString
 
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::GetParseHandlerForBinaryDXL
+//
+//	@doc:
+//		Parse the given binary DXL document and return the top-level parser.
+//		Binary documents are produced by the optimizer's own serializer and
+//		are not validated against a schema.
+//
+//---------------------------------------------------------------------------
+CParseHandlerDXL *
+CDXLUtils::GetParseHandlerForBinaryDXL
+	(
+	IMemoryPool *mp,
+	const BYTE *data,
+	ULONG size
+	)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != data);
+
+	// parse handlers transcode attribute values through the memory manager
+	CDXLMemoryManager mm(mp);
+	CDXLBinaryReader binary_reader(mp, data, size);
+
+	CParseHandlerManager parse_handler_mgr(&mm, &binary_reader);
+	CParseHandlerDXL *parse_handler_dxl = CParseHandlerFactory::GetParseHandlerDXL(mp, &parse_handler_mgr);
+	parse_handler_mgr.ActivateParseHandler(parse_handler_dxl);
+
+	// as with XML documents, the handler tree is not released if parsing
+	// fails, since partially constructed handlers cannot be destroyed safely
+	binary_reader.Parse();
+
+	GPOS_CHECK_ABORT;
+
+	return parse_handler_dxl;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::GetPlanDXLNode
@@ -848,6 +889,44 @@ CDXLUtils::ParseDXLToIMDIdCacheObj
 	return imd_cached_obj;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ParseDXLToIMDIdCacheObj
+//
+//	@doc:
+//		Parse a single metadata object given its DXL representation as a
+//		multi-byte string. Returns NULL if the DXL represents no metadata
+//		objects, or the first parsed object if it does.
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *
+CDXLUtils::ParseDXLToIMDIdCacheObj
+	(
+	IMemoryPool *mp,
+	const CHAR *dxl_string,
+	const CHAR *xsd_file_path
+	)
+{
+	GPOS_ASSERT(NULL != mp);
+
+	// create and install a parse handler for the DXL document
+	CAutoP<CParseHandlerDXL> parse_handler_dxl_array(GetParseHandlerForDXLString(mp, dxl_string, xsd_file_path));
+
+	// collect metadata objects from dxl parse handler
+	IMDCacheObjectArray *imd_obj_array = parse_handler_dxl_array->GetMdIdCachedObjArray();
+
+	if (0 == imd_obj_array->Size())
+	{
+		// no metadata objects found
+		return NULL;
+	}
+
+	IMDCacheObject *imd_cached_obj = (*imd_obj_array)[0];
+	imd_cached_obj->AddRef();
+
+	return imd_cached_obj;
+}
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -875,41 +954,62 @@ CDXLUtils::SerializeQuery
 	CAutoTimer at("\n[OPT]: DXL Query Serialization Time", GPOS_FTRACE(EopttracePrintOptimizationStatistics));
 
 	CXMLSerializer xml_serializer(mp, os, indentation);
+	SerializeQuery(mp, &xml_serializer, dxl_query_node, query_output_dxlnode_array, cte_producers, serialize_header_footer);
+}
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeQuery
+//
+//	@doc:
+//		Serialize a DXL Query tree using the given serializer
+//
+//---------------------------------------------------------------------------
+void
+CDXLUtils::SerializeQuery
+	(
+	IMemoryPool *mp,
+	CXMLSerializer *xml_serializer,
+	const CDXLNode *dxl_query_node,
+	const CDXLNodeArray *query_output_dxlnode_array,
+	const CDXLNodeArray *cte_producers,
+	BOOL serialize_header_footer
+	)
+{
 	if (serialize_header_footer)
 	{
-		SerializeHeader(mp, &xml_serializer);
+		SerializeHeader(mp, xml_serializer);
 	}
 	
-	xml_serializer.OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenQuery));
+	xml_serializer->OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenQuery));
 
 	// serialize the query output columns
-	xml_serializer.OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenQueryOutput));
+	xml_serializer->OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenQueryOutput));
 	for (ULONG ul = 0; ul < query_output_dxlnode_array->Size(); ++ul)
 	{
 		CDXLNode *scalar_ident = (*query_output_dxlnode_array)[ul];
-		scalar_ident->SerializeToDXL(&xml_serializer);
+		scalar_ident->SerializeToDXL(xml_serializer);
 	}
-	xml_serializer.CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenQueryOutput));
+	xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenQueryOutput));
 
 	// serialize the CTE list
-	xml_serializer.OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenCTEList));
+	xml_serializer->OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenCTEList));
 	const ULONG ulCTEs = cte_producers->Size();
 	for (ULONG ul = 0; ul < ulCTEs; ++ul)
 	{
 		CDXLNode *cte = (*cte_producers)[ul];
-		cte->SerializeToDXL(&xml_serializer);
+		cte->SerializeToDXL(xml_serializer);
 	}
-	xml_serializer.CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenCTEList));
+	xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenCTEList));
 
 	
-	dxl_query_node->SerializeToDXL(&xml_serializer);
+	dxl_query_node->SerializeToDXL(xml_serializer);
 
-	xml_serializer.CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenQuery));
+	xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenQuery));
 	
 	if (serialize_header_footer)
 	{
-		SerializeFooter(&xml_serializer);
+		SerializeFooter(xml_serializer);
 	}
 }
 
@@ -968,26 +1068,47 @@ CDXLUtils::SerializePlan
 	CAutoTimer at("\n[OPT]: DXL Plan Serialization Time", GPOS_FTRACE(EopttracePrintOptimizationStatistics));
 
 	CXMLSerializer xml_serializer(mp, os, indentation);
-	
+	SerializePlan(mp, &xml_serializer, node, plan_id, plan_space_size, serialize_header_footer);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializePlan
+//
+//	@doc:
+//		Serialize a DXL tree using the given serializer
+//
+//---------------------------------------------------------------------------
+void
+CDXLUtils::SerializePlan
+	(
+	IMemoryPool *mp,
+	CXMLSerializer *xml_serializer,
+	const CDXLNode *node,
+	ULLONG plan_id,
+	ULLONG plan_space_size,
+	BOOL serialize_header_footer
+	)
+{
 	if (serialize_header_footer)
 	{
-		SerializeHeader(mp, &xml_serializer);
+		SerializeHeader(mp, xml_serializer);
 	}
 	
-	xml_serializer.OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenPlan));
+	xml_serializer->OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenPlan));
 
 	// serialize plan id and space size attributes
 
-	xml_serializer.AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenPlanId), plan_id);
-	xml_serializer.AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenPlanSpaceSize), plan_space_size);
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenPlanId), plan_id);
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenPlanSpaceSize), plan_space_size);
 
-	node->SerializeToDXL(&xml_serializer);
+	node->SerializeToDXL(xml_serializer);
 
-	xml_serializer.CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenPlan));
+	xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenPlan));
 	
 	if (serialize_header_footer)
 	{
-		SerializeFooter(&xml_serializer);
+		SerializeFooter(xml_serializer);
 	}
 }
 
@@ -1014,29 +1135,46 @@ CDXLUtils::SerializeMetadata
 	GPOS_ASSERT(NULL != imd_obj_array);
 
 	CXMLSerializer xml_serializer(mp, os, indentation);
+	SerializeMetadata(mp, imd_obj_array, &xml_serializer, serialize_header_footer);
+}
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeMetadata
+//
+//	@doc:
+//		Serialize a list of MD objects using the given serializer
+//
+//---------------------------------------------------------------------------
+void
+CDXLUtils::SerializeMetadata
+	(
+	IMemoryPool *mp,
+	const IMDCacheObjectArray *imd_obj_array,
+	CXMLSerializer *xml_serializer,
+	BOOL serialize_header_footer
+	)
+{
 	if (serialize_header_footer)
 	{
-		SerializeHeader(mp, &xml_serializer);
+		SerializeHeader(mp, xml_serializer);
 	}
 	
-	xml_serializer.OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenMetadata));
+	xml_serializer->OpenElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenMetadata));
 
 
 	for (ULONG ul = 0; ul < imd_obj_array->Size(); ul++)
 	{
 		IMDCacheObject *imd_cache_obj = (*imd_obj_array)[ul];
-		imd_cache_obj->Serialize(&xml_serializer);
+		imd_cache_obj->Serialize(xml_serializer);
 	}
 
-	xml_serializer.CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenMetadata));
+	xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenMetadata));
 
 	if (serialize_header_footer)
 	{
-		SerializeFooter(&xml_serializer);
+		SerializeFooter(xml_serializer);
 	}
-	
-	return;
 }
 
 //---------------------------------------------------------------------------
@@ -1474,6 +1612,285 @@ CDXLUtils::SerializeFooter
 	xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), CDXLTokens::GetDXLTokenStr(EdxltokenDXLMessage));
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ParseBinaryDXLToPlan
+//
+//	@doc:
+//		Parse a binary DXL document into a DXL plan tree
+//
+//---------------------------------------------------------------------------
+CDXLNode *
+CDXLUtils::ParseBinaryDXLToPlan
+	(
+	IMemoryPool *mp,
+	const BYTE *data,
+	ULONG size,
+	ULLONG *plan_id,
+	ULLONG *plan_space_size
+	)
+{
+	GPOS_ASSERT(NULL != plan_id);
+	GPOS_ASSERT(NULL != plan_space_size);
+
+	CAutoP<CParseHandlerDXL> parse_handler_dxl_wrapper(GetParseHandlerForBinaryDXL(mp, data, size));
+
+	CDXLNode *root_dxl_node = parse_handler_dxl_wrapper->PdxlnPlan();
+	if (NULL == root_dxl_node)
+	{
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag, CDXLTokens::GetDXLTokenStr(EdxltokenPlan)->GetBuffer());
+	}
+
+	*plan_id = parse_handler_dxl_wrapper->GetPlanId();
+	*plan_space_size = parse_handler_dxl_wrapper->GetPlanSpaceSize();
+
+	root_dxl_node->AddRef();
+
+	return root_dxl_node;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ParseBinaryDXLToQuery
+//
+//	@doc:
+//		Parse a binary DXL document into the DXL trees representing the
+//		query, the query output and the CTE producers
+//
+//---------------------------------------------------------------------------
+CQueryToDXLResult *
+CDXLUtils::ParseBinaryDXLToQuery
+	(
+	IMemoryPool *mp,
+	const BYTE *data,
+	ULONG size
+	)
+{
+	CAutoP<CParseHandlerDXL> parse_handler_dxl_wrapper(GetParseHandlerForBinaryDXL(mp, data, size));
+
+	CDXLNode *root_dxl_node = parse_handler_dxl_wrapper->GetQueryDXLRoot();
+	if (NULL == root_dxl_node)
+	{
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag, CDXLTokens::GetDXLTokenStr(EdxltokenQuery)->GetBuffer());
+	}
+
+	CDXLNodeArray *query_output_cols_dxlnode_array = parse_handler_dxl_wrapper->GetOutputColumnsDXLArray();
+	CDXLNodeArray *cte_producers = parse_handler_dxl_wrapper->GetCTEProducerDXLArray();
+	GPOS_ASSERT(NULL != query_output_cols_dxlnode_array);
+	GPOS_ASSERT(NULL != cte_producers);
+
+	root_dxl_node->AddRef();
+	query_output_cols_dxlnode_array->AddRef();
+	cte_producers->AddRef();
+
+	return GPOS_NEW(mp) CQueryToDXLResult(root_dxl_node, query_output_cols_dxlnode_array, cte_producers);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ParseBinaryDXLToIMDObjectArray
+//
+//	@doc:
+//		Parse a list of metadata objects from a binary DXL document
+//
+//---------------------------------------------------------------------------
+IMDCacheObjectArray *
+CDXLUtils::ParseBinaryDXLToIMDObjectArray
+	(
+	IMemoryPool *mp,
+	const BYTE *data,
+	ULONG size
+	)
+{
+	CAutoP<CParseHandlerDXL> parse_handler_dxl_wrapper(GetParseHandlerForBinaryDXL(mp, data, size));
+
+	IMDCacheObjectArray *imd_obj_array = parse_handler_dxl_wrapper->GetMdIdCachedObjArray();
+	if (NULL == imd_obj_array)
+	{
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag, CDXLTokens::GetDXLTokenStr(EdxltokenMetadata)->GetBuffer());
+	}
+
+	imd_obj_array->AddRef();
+
+	return imd_obj_array;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeQueryToBinary
+//
+//	@doc:
+//		Serialize a DXL query tree into a binary DXL document allocated in
+//		the given memory pool
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::SerializeQueryToBinary
+	(
+	IMemoryPool *mp,
+	const CDXLNode *dxl_query_node,
+	const CDXLNodeArray *query_output_dxlnode_array,
+	const CDXLNodeArray *cte_producers,
+	ULONG *size
+	)
+{
+	GPOS_ASSERT(NULL != size);
+
+	CDXLBinarySerializer binary_serializer(mp);
+	SerializeQuery(mp, &binary_serializer, dxl_query_node, query_output_dxlnode_array, cte_producers, true /*serialize_header_footer*/);
+	binary_serializer.EndDocument();
+
+	*size = binary_serializer.Size();
+	return binary_serializer.CopyBuffer(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializePlanToBinary
+//
+//	@doc:
+//		Serialize a DXL plan tree into a binary DXL document allocated in
+//		the given memory pool
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::SerializePlanToBinary
+	(
+	IMemoryPool *mp,
+	const CDXLNode *node,
+	ULLONG plan_id,
+	ULLONG plan_space_size,
+	ULONG *size
+	)
+{
+	GPOS_ASSERT(NULL != size);
+
+	CAutoTimer at("\n[OPT]: DXL Plan Serialization Time", GPOS_FTRACE(EopttracePrintOptimizationStatistics));
+
+	CDXLBinarySerializer binary_serializer(mp);
+	SerializePlan(mp, &binary_serializer, node, plan_id, plan_space_size, true /*serialize_header_footer*/);
+	binary_serializer.EndDocument();
+
+	*size = binary_serializer.Size();
+	return binary_serializer.CopyBuffer(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeMetadataToBinary
+//
+//	@doc:
+//		Serialize a list of MD objects into a binary DXL document allocated
+//		in the given memory pool
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::SerializeMetadataToBinary
+	(
+	IMemoryPool *mp,
+	const IMDCacheObjectArray *imd_obj_array,
+	ULONG *size
+	)
+{
+	GPOS_ASSERT(NULL != imd_obj_array);
+	GPOS_ASSERT(NULL != size);
+
+	CDXLBinarySerializer binary_serializer(mp);
+	SerializeMetadata(mp, imd_obj_array, &binary_serializer, true /*serialize_header_footer*/);
+	binary_serializer.EndDocument();
+
+	*size = binary_serializer.Size();
+	return binary_serializer.CopyBuffer(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ConvertDXLToBinary
+//
+//	@doc:
+//		Convert a DXL document of any kind into a binary DXL document
+//		allocated in the given memory pool, without interpreting it
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::ConvertDXLToBinary
+	(
+	IMemoryPool *mp,
+	const CHAR *dxl_string,
+	ULONG *size
+	)
+{
+	GPOS_ASSERT(NULL != dxl_string);
+	GPOS_ASSERT(NULL != size);
+
+	CDXLBinarySerializer binary_serializer(mp);
+	{
+		CDXLEventSerializer event_serializer(mp, &binary_serializer);
+
+		// we need to disable OOM simulation here, otherwise xerces throws ABORT signal
+		CAutoTraceFlag auto_trace_flg1(EtraceSimulateOOM, false);
+		CAutoTraceFlag auto_trace_flg2(EtraceSimulateAbort, false);
+
+		CDXLMemoryManager mm(mp);
+		SAX2XMLReader *sax_2_xml_reader = XMLReaderFactory::createXMLReader(&mm);
+		sax_2_xml_reader->setContentHandler(&event_serializer);
+		sax_2_xml_reader->setErrorHandler(&event_serializer);
+
+		MemBufInputSource input_src_memory_buffer((const XMLByte*) dxl_string, strlen(dxl_string), "dxl", false, &mm);
+
+		try
+		{
+			sax_2_xml_reader->parse(input_src_memory_buffer);
+		}
+		catch (const XMLException&)
+		{
+			delete sax_2_xml_reader;
+			GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+		}
+		catch (const SAXException&)
+		{
+			delete sax_2_xml_reader;
+			GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+		}
+
+		delete sax_2_xml_reader;
+	}
+	binary_serializer.EndDocument();
+
+	*size = binary_serializer.Size();
+	return binary_serializer.CopyBuffer(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ConvertBinaryToDXL
+//
+//	@doc:
+//		Convert a binary DXL document into an XML DXL document
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+CDXLUtils::ConvertBinaryToDXL
+	(
+	IMemoryPool *mp,
+	const BYTE *data,
+	ULONG size,
+	BOOL indentation
+	)
+{
+	CAutoP<CWStringDynamic> dxl_string(GPOS_NEW(mp) CWStringDynamic(mp));
+	COstreamString oss(dxl_string.Value());
+
+	CXMLSerializer xml_serializer(mp, oss, indentation);
+	CDXLEventSerializer event_serializer(mp, &xml_serializer);
+
+	CDXLBinaryReader binary_reader(mp, data, size);
+	binary_reader.SetContentHandler(&event_serializer);
+	binary_reader.Parse();
+
+	return dxl_string.Reset();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::CreateDynamicStringFromXMLChArray
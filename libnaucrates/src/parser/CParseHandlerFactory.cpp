@@ -70,6 +70,7 @@ CParseHandlerFactory::Init
 			{EdxltokenCTEConfig, &CreateCTECfgParseHandler},
 			{EdxltokenCostModelConfig, &CreateCostModelCfgParseHandler},
 			{EdxltokenHint, &CreateHintParseHandler},
+			{EdxltokenSchedulerConfig, &CreateSchedulerCfgParseHandler},
 			{EdxltokenWindowOids, &CreateWindowOidsParseHandler},
 
 			{EdxltokenRelation, &CreateMDRelationParseHandler},
@@ -456,6 +457,18 @@ CParseHandlerFactory::CreateHintParseHandler
 	return GPOS_NEW(mp) CParseHandlerHint(mp, parse_handler_mgr, parse_handler_root);
 }
 
+// creates a parse handler for parsing scheduler configuration
+CParseHandlerBase *
+CParseHandlerFactory::CreateSchedulerCfgParseHandler
+	(
+	IMemoryPool *mp,
+	CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root
+	)
+{
+	return GPOS_NEW(mp) CParseHandlerSchedulerConfig(mp, parse_handler_mgr, parse_handler_root);
+}
+
 // creates a parse handler for parsing window oids configuration
 CParseHandlerBase *
 CParseHandlerFactory::CreateWindowOidsParseHandler
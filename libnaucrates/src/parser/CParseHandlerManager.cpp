@@ -10,6 +10,7 @@
 //---------------------------------------------------------------------------
 
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 
 using namespace gpdxl;
@@ -34,6 +35,30 @@ CParseHandlerManager::CParseHandlerManager
 	:
 	m_dxl_memory_manager(dxl_memory_manager),
 	m_xml_reader(sax_2_xml_reader),
+	m_binary_reader(NULL),
+	m_curr_parse_handler(NULL),
+	m_iteration_since_last_abortcheck(0)
+{
+	m_parse_handler_stack = GPOS_NEW(dxl_memory_manager->Pmp()) ParseHandlerStack(dxl_memory_manager->Pmp());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerManager::CParseHandlerManager
+//
+//	@doc:
+//		Constructor for parsing binary DXL documents
+//
+//---------------------------------------------------------------------------
+CParseHandlerManager::CParseHandlerManager
+	(
+	CDXLMemoryManager *dxl_memory_manager,
+	CDXLBinaryReader *binary_reader
+	)
+	:
+	m_dxl_memory_manager(dxl_memory_manager),
+	m_xml_reader(NULL),
+	m_binary_reader(binary_reader),
 	m_curr_parse_handler(NULL),
 	m_iteration_since_last_abortcheck(0)
 {
@@ -76,8 +101,7 @@ CParseHandlerManager::ActivateParseHandler(CParseHandlerBase *parse_handler_base
 	GPOS_ASSERT(NULL != parse_handler_base);
 	
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	SetContentHandler(parse_handler_base);
 }
 
 //---------------------------------------------------------------------------
@@ -106,8 +130,7 @@ CParseHandlerManager::ReplaceHandler
 	}
 	
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);	
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	SetContentHandler(parse_handler_base);
 }
 
 
@@ -137,8 +160,34 @@ CParseHandlerManager::DeactivateHandler()
 		m_curr_parse_handler = NULL;
 	}
 	
-	m_xml_reader->setContentHandler(m_curr_parse_handler);
-	m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	SetContentHandler(m_curr_parse_handler);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerManager::SetContentHandler
+//
+//	@doc:
+//		Direct the events of the document being parsed to the given handler
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerManager::SetContentHandler
+	(
+	CParseHandlerBase *parse_handler_base
+	)
+{
+	if (NULL != m_binary_reader)
+	{
+		m_binary_reader->SetContentHandler(parse_handler_base);
+		return;
+	}
+
+	if (NULL != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(parse_handler_base);
+		m_xml_reader->setErrorHandler(parse_handler_base);
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include "naucrates/dxl/parser/CParseHandlerCTEConfig.h"
 #include "naucrates/dxl/parser/CParseHandlerCostModel.h"
 #include "naucrates/dxl/parser/CParseHandlerHint.h"
+#include "naucrates/dxl/parser/CParseHandlerSchedulerConfig.h"
 #include "naucrates/dxl/parser/CParseHandlerWindowOids.h"
 
 
@@ -56,7 +57,8 @@ CParseHandlerOptimizerConfig::CParseHandlerOptimizerConfig
 	:
 	CParseHandlerBase(mp, parse_handler_mgr, parse_handler_root),
 	m_pbs(NULL),
-	m_optimizer_config(NULL)
+	m_optimizer_config(NULL),
+	m_ulOptimizationBudget(gpos::ulong_max)
 {
 }
 
@@ -100,6 +102,16 @@ CParseHandlerOptimizerConfig::StartElement
 		this->Append(pphHint);
 		return;
 
+	}
+	else if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenSchedulerConfig), element_local_name))
+	{
+		// install a parse handler for the scheduler config
+		CParseHandlerBase *pphSchedulerConfig = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenSchedulerConfig), m_parse_handler_mgr, this);
+		m_parse_handler_mgr->ActivateParseHandler(pphSchedulerConfig);
+		pphSchedulerConfig->startElement(element_uri, element_local_name, element_qname, attrs);
+		this->Append(pphSchedulerConfig);
+		return;
+
 	}
 	else if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenCostModelConfig), element_local_name))
 	{
@@ -127,6 +139,17 @@ CParseHandlerOptimizerConfig::StartElement
 		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag, str->GetBuffer());
 	}
 
+	// optimization is unbounded unless a budget is given
+	m_ulOptimizationBudget = CDXLOperatorFactory::ExtractConvertAttrValueToUlong
+							(
+							m_parse_handler_mgr->GetDXLMemoryManager(),
+							attrs,
+							EdxltokenOptimizationBudget,
+							EdxltokenOptimizerConfig,
+							true, // is_optional
+							gpos::ulong_max
+							);
+
 	CParseHandlerBase *pphWindowOids = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenWindowOids), m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(pphWindowOids);
 
@@ -172,7 +195,7 @@ CParseHandlerOptimizerConfig::EndElement
 	}
 	
 	GPOS_ASSERT(NULL == m_optimizer_config);
-	GPOS_ASSERT(7 >= this->Length());
+	GPOS_ASSERT(8 >= this->Length());
 
 	CParseHandlerEnumeratorConfig *pphEnumeratorConfig = dynamic_cast<CParseHandlerEnumeratorConfig *>((*this)[0]);
 	CEnumeratorConfig *pec = pphEnumeratorConfig->GetEnumeratorCfg();
@@ -193,11 +216,13 @@ CParseHandlerOptimizerConfig::EndElement
 
 	ICostModel *pcm = NULL;
 	CHint *phint = NULL;
+	CSchedulerConfig *psched_conf = NULL;
 	if (5 == this->Length())
 	{
 		// no cost model: use default one
 		pcm = ICostModel::PcmDefault(m_mp);
 		phint = CHint::PhintDefault(m_mp);
+		psched_conf = CSchedulerConfig::PschedconfDefault(m_mp);
 	}
 	else
 	{
@@ -217,9 +242,22 @@ CParseHandlerOptimizerConfig::EndElement
 			GPOS_ASSERT(NULL != phint);
 			phint->AddRef();
 		}
+
+		if (8 > this->Length())
+		{
+			// no scheduler configuration: use default one
+			psched_conf = CSchedulerConfig::PschedconfDefault(m_mp);
+		}
+		else
+		{
+			CParseHandlerSchedulerConfig *pphSchedulerConfig = dynamic_cast<CParseHandlerSchedulerConfig *>((*this)[6]);
+			psched_conf = pphSchedulerConfig->GetSchedulerConf();
+			GPOS_ASSERT(NULL != psched_conf);
+			psched_conf->AddRef();
+		}
 	}
 
-	m_optimizer_config = GPOS_NEW(m_mp) COptimizerConfig(pec, stats_config, pcteconfig, pcm, phint, pwindowoidsGPDB);
+	m_optimizer_config = GPOS_NEW(m_mp) COptimizerConfig(pec, stats_config, pcteconfig, pcm, phint, pwindowoidsGPDB, psched_conf, m_ulOptimizationBudget);
 
 	CParseHandlerTraceFlags *pphTraceFlags = dynamic_cast<CParseHandlerTraceFlags *>((*this)[this->Length() - 1]);
 	pphTraceFlags->GetTraceFlagBitSet()->AddRef();
@@ -0,0 +1,241 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CParseHandlerSchedulerConfig.cpp
+//
+//	@doc:
+//		Implementation of the SAX parse handler class for parsing scheduler
+//		configuration
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/dxl/parser/CParseHandlerFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerSchedulerConfig.h"
+
+#include "naucrates/dxl/operators/CDXLOperatorFactory.h"
+
+#include "naucrates/dxl/xml/dxltokens.h"
+
+#include "gpopt/engine/CSchedulerConfig.h"
+
+using namespace gpdxl;
+using namespace gpopt;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerSchedulerConfig::CParseHandlerSchedulerConfig
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CParseHandlerSchedulerConfig::CParseHandlerSchedulerConfig
+	(
+	IMemoryPool *mp,
+	CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root
+	)
+	:
+	CParseHandlerBase(mp, parse_handler_mgr, parse_handler_root),
+	m_sched_conf(NULL)
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerSchedulerConfig::~CParseHandlerSchedulerConfig
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CParseHandlerSchedulerConfig::~CParseHandlerSchedulerConfig()
+{
+	CRefCount::SafeRelease(m_sched_conf);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerSchedulerConfig::ParseSchedulingPolicy
+//
+//	@doc:
+//		Parse the scheduling policy from the attribute value. Raise
+//		exception if it is invalid
+//
+//---------------------------------------------------------------------------
+CSchedulerConfig::ESchedulingPolicy
+CParseHandlerSchedulerConfig::ParseSchedulingPolicy
+	(
+	const XMLCh *policy_xml
+	)
+{
+	if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenSchedulingPolicySharedQueue), policy_xml))
+	{
+		return CSchedulerConfig::EspSharedQueue;
+	}
+
+	if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenSchedulingPolicyWorkStealing), policy_xml))
+	{
+		return CSchedulerConfig::EspWorkStealing;
+	}
+
+	if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenSchedulingPolicyPriority), policy_xml))
+	{
+		return CSchedulerConfig::EspPriority;
+	}
+
+	GPOS_RAISE
+		(
+		gpdxl::ExmaDXL,
+		gpdxl::ExmiDXLInvalidAttributeValue,
+		CDXLTokens::GetDXLTokenStr(EdxltokenSchedulingPolicy)->GetBuffer(),
+		CDXLTokens::GetDXLTokenStr(EdxltokenSchedulerConfig)->GetBuffer()
+		);
+
+	return CSchedulerConfig::EspSentinel;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerSchedulerConfig::ParseWorkerPolicy
+//
+//	@doc:
+//		Parse the worker policy from the attribute value; the fixed
+//		queued/running ratio is used if the attribute is missing
+//
+//---------------------------------------------------------------------------
+CSchedulerConfig::EWorkerPolicy
+CParseHandlerSchedulerConfig::ParseWorkerPolicy
+	(
+	const XMLCh *policy_xml
+	)
+{
+	if (NULL == policy_xml ||
+		0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenWorkerPolicyQueuedRunningRatio), policy_xml))
+	{
+		return CSchedulerConfig::EwpQueuedRunningRatio;
+	}
+
+	if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenWorkerPolicyAdaptive), policy_xml))
+	{
+		return CSchedulerConfig::EwpAdaptive;
+	}
+
+	GPOS_RAISE
+		(
+		gpdxl::ExmaDXL,
+		gpdxl::ExmiDXLInvalidAttributeValue,
+		CDXLTokens::GetDXLTokenStr(EdxltokenWorkerPolicy)->GetBuffer(),
+		CDXLTokens::GetDXLTokenStr(EdxltokenSchedulerConfig)->GetBuffer()
+		);
+
+	return CSchedulerConfig::EwpSentinel;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerSchedulerConfig::StartElement
+//
+//	@doc:
+//		Invoked by Xerces to process an opening tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerSchedulerConfig::StartElement
+	(
+	const XMLCh* const , //element_uri,
+	const XMLCh* const element_local_name,
+	const XMLCh* const , //element_qname,
+	const Attributes& attrs
+	)
+{
+	if (0 != XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenSchedulerConfig), element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag, str->GetBuffer());
+	}
+
+	// parse scheduler configuration options
+	const XMLCh *policy_xml = CDXLOperatorFactory::ExtractAttrValue(attrs, EdxltokenSchedulingPolicy, EdxltokenSchedulerConfig);
+	CSchedulerConfig::ESchedulingPolicy esp = ParseSchedulingPolicy(policy_xml);
+
+	const XMLCh *worker_policy_xml = CDXLOperatorFactory::ExtractAttrValue(attrs, EdxltokenWorkerPolicy, EdxltokenSchedulerConfig, true /*is_optional*/);
+	CSchedulerConfig::EWorkerPolicy ewp = ParseWorkerPolicy(worker_policy_xml);
+
+	ULONG workers = CDXLOperatorFactory::ExtractConvertAttrValueToUlong(m_parse_handler_mgr->GetDXLMemoryManager(), attrs, EdxltokenSchedulerWorkers, EdxltokenSchedulerConfig);
+	if (0 == workers)
+	{
+		GPOS_RAISE
+			(
+			gpdxl::ExmaDXL,
+			gpdxl::ExmiDXLInvalidAttributeValue,
+			CDXLTokens::GetDXLTokenStr(EdxltokenSchedulerWorkers)->GetBuffer(),
+			CDXLTokens::GetDXLTokenStr(EdxltokenSchedulerConfig)->GetBuffer()
+			);
+	}
+
+	m_sched_conf = GPOS_NEW(m_mp) CSchedulerConfig(esp, ewp, workers);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerSchedulerConfig::EndElement
+//
+//	@doc:
+//		Invoked by Xerces to process a closing tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerSchedulerConfig::EndElement
+	(
+	const XMLCh* const, // element_uri,
+	const XMLCh* const element_local_name,
+	const XMLCh* const // element_qname
+	)
+{
+	if (0 != XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenSchedulerConfig), element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE( gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag, str->GetBuffer());
+	}
+
+	GPOS_ASSERT(NULL != m_sched_conf);
+	GPOS_ASSERT(0 == this->Length());
+
+	// deactivate handler
+	m_parse_handler_mgr->DeactivateHandler();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerSchedulerConfig::GetParseHandlerType
+//
+//	@doc:
+//		Return the type of the parse handler.
+//
+//---------------------------------------------------------------------------
+EDxlParseHandlerType
+CParseHandlerSchedulerConfig::GetParseHandlerType() const
+{
+	return EdxlphSchedulerConfig;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerSchedulerConfig::GetSchedulerConf
+//
+//	@doc:
+//		Returns the scheduler configuration
+//
+//---------------------------------------------------------------------------
+CSchedulerConfig *
+CParseHandlerSchedulerConfig::GetSchedulerConf() const
+{
+	return m_sched_conf;
+}
+
+// EOF
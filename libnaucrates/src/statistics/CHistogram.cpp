@@ -12,11 +12,13 @@
 
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/statistics/CHistogram.h"
+#include "naucrates/statistics/CHistogramBounds.h"
 #include "naucrates/dxl/operators/CDXLScalarConstValue.h"
 #include "naucrates/dxl/CDXLUtils.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 #include "gpos/common/syslibwrapper.h"
+#include "gpos/sync/atomic.h"
 
 #include "naucrates/statistics/CStatistics.h"
 #include "naucrates/statistics/CStatisticsUtils.h"
@@ -24,6 +26,9 @@
 #include "naucrates/statistics/CScaleFactorUtils.h"
 
 #include "gpopt/base/CColRef.h"
+#include "gpopt/mdcache/CMDAccessor.h"
+
+#include "naucrates/md/IMDColStats.h"
 
 using namespace gpnaucrates;
 using namespace gpopt;
@@ -50,6 +55,9 @@ const CDouble CHistogram::DefaultNDVFreqRemain(0.0);
 // sample size used to estimate skew
 #define GPOPT_SKEW_SAMPLE_SIZE 1000
 
+// minimum number of buckets for filters to binary search the bucket bounds
+#define GPOPT_HISTOGRAM_BOUNDS_MIN_BUCKETS 16
+
 // ctor
 CHistogram::CHistogram
 	(
@@ -58,6 +66,11 @@ CHistogram::CHistogram
 	)
 	:
 	m_histogram_buckets(histogram_buckets),
+	m_mp(NULL),
+	m_md_accessor(NULL),
+	m_mdid_type(NULL),
+	m_md_col_stats(NULL),
+	m_bounds(NULL),
 	m_is_well_defined(is_well_defined),
 	m_null_freq(CHistogram::DefaultNullFreq),
 	m_distinct_remaining(DefaultNDVRemain),
@@ -82,6 +95,11 @@ CHistogram::CHistogram
 	)
 	:
 	m_histogram_buckets(histogram_buckets),
+	m_mp(NULL),
+	m_md_accessor(NULL),
+	m_mdid_type(NULL),
+	m_md_col_stats(NULL),
+	m_bounds(NULL),
 	m_is_well_defined(is_well_defined),
 	m_null_freq(null_freq),
 	m_distinct_remaining(distinct_remaining),
@@ -101,6 +119,115 @@ CHistogram::CHistogram
 	GPOS_ASSERT_IMP(distinct_remaining < CStatistics::Epsilon, freq_remaining < CStatistics::Epsilon);
 }
 
+// ctor
+CHistogram::CHistogram
+	(
+	IMemoryPool *mp,
+	CMDAccessor *md_accessor,
+	IMDId *mdid_type,
+	const IMDColStats *md_col_stats
+	)
+	:
+	m_histogram_buckets(NULL),
+	m_mp(mp),
+	m_md_accessor(md_accessor),
+	m_mdid_type(mdid_type),
+	m_md_col_stats(md_col_stats),
+	m_bounds(NULL),
+	m_is_well_defined(true),
+	m_null_freq(md_col_stats->GetNullFreq()),
+	m_distinct_remaining(md_col_stats->GetDistinctRemain()),
+	m_freq_remaining(md_col_stats->GetFreqRemain()),
+	m_skew_was_measured(false),
+	m_skew(1.0),
+	m_NDVs_were_scaled(false),
+	m_is_col_stats_missing(md_col_stats->IsColStatsMissing())
+{
+	GPOS_ASSERT(NULL != md_accessor);
+	GPOS_ASSERT(NULL != mdid_type);
+	GPOS_ASSERT(CDouble(0.0) <= m_null_freq);
+	GPOS_ASSERT(CDouble(1.0) >= m_null_freq);
+}
+
+// dtor
+CHistogram::~CHistogram()
+{
+	CRefCount::SafeRelease(m_histogram_buckets);
+	CRefCount::SafeRelease(m_bounds);
+}
+
+// construct the buckets from the column statistics; histograms of base
+// tables may be read by concurrent optimization jobs, so the buckets are
+// published only once
+void
+CHistogram::MaterializeBuckets() const
+{
+	GPOS_ASSERT(NULL != m_md_accessor);
+	GPOS_ASSERT(NULL != m_md_col_stats);
+
+	CBucketArray *buckets = m_md_accessor->GetBucketArray(m_mp, m_mdid_type, m_md_col_stats);
+	if (!CompareSwap<CBucketArray>
+			(
+			(volatile CBucketArray**) &m_histogram_buckets,
+			NULL,
+			buckets
+			))
+	{
+		buckets->Release();
+	}
+}
+
+// index of the first bucket the point is not after; buckets before it
+// lie entirely below the point, so filters can skip comparing them. The
+// bounds are packed once per histogram and shared by its copies
+ULONG
+CHistogram::GetFirstBucketIndex
+	(
+	IMemoryPool *mp,
+	const CPoint *point
+	)
+	const
+{
+	if (GPOPT_HISTOGRAM_BOUNDS_MIN_BUCKETS > GetBuckets()->Size() ||
+		GPOS_FTRACE(EopttraceDisableHistogramBoundsSearch))
+	{
+		return 0;
+	}
+
+	if (NULL == m_bounds)
+	{
+		CHistogramBounds *bounds = GPOS_NEW(mp) CHistogramBounds(mp, GetBuckets());
+		if (!CompareSwap<CHistogramBounds>
+				(
+				(volatile CHistogramBounds**) &m_bounds,
+				NULL,
+				bounds
+				))
+		{
+			bounds->Release();
+		}
+	}
+
+	if (!m_bounds->CanSearch(point))
+	{
+		return 0;
+	}
+
+	return m_bounds->GetBucketIndex(point);
+}
+
+// number of buckets
+ULONG
+CHistogram::Buckets() const
+{
+	if (!IsMaterialized())
+	{
+		return m_md_col_stats->Buckets();
+	}
+
+	return m_histogram_buckets->Size();
+}
+
 // set histograms null frequency
 void
 CHistogram::SetNullFrequency
@@ -122,11 +249,11 @@ CHistogram::OsPrint
 {
 	os << std::endl << "[" << std::endl;
 
-	ULONG num_buckets = m_histogram_buckets->Size();
+	ULONG num_buckets = GetBuckets()->Size();
 	for (ULONG bucket_index = 0; bucket_index < num_buckets; bucket_index++)
 	{
 		os << "b" << bucket_index << " = ";
-		(*m_histogram_buckets)[bucket_index]->OsPrint(os);
+		(*GetBuckets())[bucket_index]->OsPrint(os);
 		os << std::endl;
 	}
 	os << "]" << std::endl;
@@ -157,7 +284,7 @@ CHistogram::IsEmpty
 	()
 	const
 {
-	return (0 == m_histogram_buckets->Size() && CStatistics::Epsilon > m_null_freq && CStatistics::Epsilon > m_distinct_remaining);
+	return (0 == Buckets() && CStatistics::Epsilon > m_null_freq && CStatistics::Epsilon > m_distinct_remaining);
 }
 
 // construct new histogram with less than or less than equal to filter
@@ -173,11 +300,18 @@ CHistogram::MakeHistogramLessThanOrLessThanEqualFilter
 	GPOS_ASSERT(CStatsPred::EstatscmptL == stats_cmp_type || CStatsPred::EstatscmptLEq == stats_cmp_type);
 
 	CBucketArray *new_buckets = GPOS_NEW(mp) CBucketArray(mp);
-	const ULONG num_buckets = m_histogram_buckets->Size();
+	const ULONG num_buckets = GetBuckets()->Size();
+	const ULONG first_bucket_index = GetFirstBucketIndex(mp, point);
 
-	for (ULONG bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	// buckets the point is after are kept as they are
+	for (ULONG bucket_index = 0; bucket_index < first_bucket_index; bucket_index++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		new_buckets->Append((*GetBuckets())[bucket_index]->MakeBucketCopy(mp));
+	}
+
+	for (ULONG bucket_index = first_bucket_index; bucket_index < num_buckets; bucket_index++)
+	{
+		CBucket *bucket = (*GetBuckets())[bucket_index];
 		if (bucket->IsBefore(point))
 		{
 			break;
@@ -227,12 +361,23 @@ CHistogram::MakeBucketsWithInequalityFilter
 {
 	GPOS_ASSERT(NULL != point);
 	CBucketArray *new_buckets = GPOS_NEW(mp) CBucketArray(mp);
-	const ULONG num_buckets = m_histogram_buckets->Size();
+	const ULONG num_buckets = GetBuckets()->Size();
 	bool point_is_null = point->GetDatum()->IsNull();
+	ULONG first_bucket_index = 0;
+	if (!point_is_null)
+	{
+		first_bucket_index = GetFirstBucketIndex(mp, point);
+	}
 
-	for (ULONG bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	// buckets the point is after cannot contain it
+	for (ULONG bucket_index = 0; bucket_index < first_bucket_index; bucket_index++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		new_buckets->Append((*GetBuckets())[bucket_index]->MakeBucketCopy(mp));
+	}
+
+	for (ULONG bucket_index = first_bucket_index; bucket_index < num_buckets; bucket_index++)
+	{
+		CBucket *bucket = (*GetBuckets())[bucket_index];
 
 		if (bucket->Contains(point) && !point_is_null)
 		{
@@ -313,12 +458,12 @@ CHistogram::MakeBucketsWithEqualityFilter
 		return histogram_buckets;
 	}
 
-	const ULONG num_buckets = m_histogram_buckets->Size();
+	const ULONG num_buckets = GetBuckets()->Size();
 	ULONG bucket_index = 0;
 
-	for (bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	for (bucket_index = GetFirstBucketIndex(mp, point); bucket_index < num_buckets; bucket_index++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		CBucket *bucket = (*GetBuckets())[bucket_index];
 
 		if (bucket->Contains(point))
 		{
@@ -436,13 +581,13 @@ CHistogram::MakeHistogramGreaterThanOrGreaterThanEqualFilter
 	GPOS_ASSERT(CStatsPred::EstatscmptGEq == stats_cmp_type || CStatsPred::EstatscmptG == stats_cmp_type);
 
 	CBucketArray *new_buckets = GPOS_NEW(mp) CBucketArray(mp);
-	const ULONG num_buckets = m_histogram_buckets->Size();
+	const ULONG num_buckets = GetBuckets()->Size();
 
-	// find first bucket that contains point
+	// find first bucket that contains point, skipping the buckets the point is after
 	ULONG bucket_index = 0;
-	for (bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	for (bucket_index = GetFirstBucketIndex(mp, point); bucket_index < num_buckets; bucket_index++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		CBucket *bucket = (*GetBuckets())[bucket_index];
 		if (bucket->IsBefore(point))
 		{
 			break;
@@ -471,7 +616,7 @@ CHistogram::MakeHistogramGreaterThanOrGreaterThanEqualFilter
 	// add rest of the buckets
 	for (; bucket_index < num_buckets; bucket_index++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		CBucket *bucket = (*GetBuckets())[bucket_index];
 		new_buckets->Append(bucket->MakeBucketCopy(mp));
 	}
 
@@ -500,9 +645,15 @@ CHistogram::GetFrequency
 	const
 {
 	CDouble frequency(0.0);
-	const ULONG num_of_buckets = m_histogram_buckets->Size();
+	const ULONG num_of_buckets = Buckets();
 	for (ULONG bucket_index = 0; bucket_index < num_of_buckets; bucket_index++)
 	{
+		if (!IsMaterialized())
+		{
+			frequency = frequency + m_md_col_stats->GetDXLBucketAt(bucket_index)->GetFrequency();
+			continue;
+		}
+
 		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
 		frequency = frequency + bucket->GetFrequency();
 	}
@@ -522,9 +673,15 @@ CHistogram::GetNumDistinct
 	const
 {
 	CDouble distinct(0.0);
-	const ULONG num_of_buckets = m_histogram_buckets->Size();
+	const ULONG num_of_buckets = Buckets();
 	for (ULONG bucket_index = 0; bucket_index < num_of_buckets; bucket_index++)
 	{
+		if (!IsMaterialized())
+		{
+			distinct = distinct + m_md_col_stats->GetDXLBucketAt(bucket_index)->GetNumDistinct();
+			continue;
+		}
+
 		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
 		distinct = distinct + bucket->GetNumDistinct();
 	}
@@ -544,7 +701,6 @@ CHistogram::CapNDVs
 	CDouble rows
 	)
 {
-	const ULONG num_of_buckets = m_histogram_buckets->Size();
 	CDouble distinct = GetNumDistinct();
 	if (rows >= distinct)
 	{
@@ -552,12 +708,14 @@ CHistogram::CapNDVs
 		return;
 	}
 
+	const ULONG num_of_buckets = GetBuckets()->Size();
+
 	m_NDVs_were_scaled = true;
 
 	CDouble scale_ratio = (rows / distinct).Get();
 	for (ULONG ul = 0; ul < num_of_buckets; ul++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[ul];
+		CBucket *bucket = (*GetBuckets())[ul];
 		CDouble distinct_bucket = bucket->GetNumDistinct();
 		bucket->SetDistinct(std::max(CHistogram::MinDistinct.Get(), (distinct_bucket * scale_ratio).Get()));
 	}
@@ -594,10 +752,10 @@ CHistogram::IsValid
 
 	if (!IsHistogramForTextRelatedTypes())
 	{
-		for (ULONG bucket_index = 1; bucket_index < m_histogram_buckets->Size(); bucket_index++)
+		for (ULONG bucket_index = 1; bucket_index < GetBuckets()->Size(); bucket_index++)
 		{
-			CBucket *bucket = (*m_histogram_buckets)[bucket_index];
-			CBucket *previous_bucket = (*m_histogram_buckets)[bucket_index - 1];
+			CBucket *bucket = (*GetBuckets())[bucket_index];
+			CBucket *previous_bucket = (*GetBuckets())[bucket_index - 1];
 
 			// the later bucket's lower point must be greater than or equal to
 			// earlier bucket's upper point. Even if the underlying datum does not
@@ -925,7 +1083,7 @@ CHistogram::MakeLASJHistogram
 	while (idx1 < buckets1 && idx2 < buckets2)
 	{
 		// bucket from other histogram
-		CBucket *bucket2 = (*histogram->m_histogram_buckets) [idx2];
+		CBucket *bucket2 = (*histogram->GetBuckets()) [idx2];
 
 		// yet to choose a candidate
 		GPOS_ASSERT(NULL == candidate_bucket);
@@ -936,7 +1094,7 @@ CHistogram::MakeLASJHistogram
 		}
 		else
 		{
-			candidate_bucket = (*m_histogram_buckets)[idx1]->MakeBucketCopy(mp); // candidate bucket in result histogram
+			candidate_bucket = (*GetBuckets())[idx1]->MakeBucketCopy(mp); // candidate bucket in result histogram
 			idx1++;
 		}
 
@@ -969,7 +1127,7 @@ CHistogram::MakeLASJHistogram
 			new_buckets->Append(candidate_bucket);
 		}
 
-		CStatisticsUtils::AddRemainingBuckets(mp, m_histogram_buckets, new_buckets, &idx1);
+		CStatisticsUtils::AddRemainingBuckets(mp, GetBuckets(), new_buckets, &idx1);
 	}
 	else
 	{
@@ -994,9 +1152,9 @@ CHistogram::NormalizeHistogram()
 
 	CDouble scale_factor = std::max(DOUBLE(1.0), (CDouble(1.0) / GetFrequency()).Get());
 
-	for (ULONG ul = 0; ul < m_histogram_buckets->Size(); ul++)
+	for (ULONG ul = 0; ul < GetBuckets()->Size(); ul++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[ul];
+		CBucket *bucket = (*GetBuckets())[ul];
 		bucket->SetFrequency(bucket->GetFrequency() * scale_factor);
 	}
 
@@ -1020,14 +1178,35 @@ CHistogram::CopyHistogram
 	)
 	const
 {
-	CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp);
-	for (ULONG ul = 0; ul < m_histogram_buckets->Size(); ul++)
+	CHistogram *histogram_copy = NULL;
+	if (!IsMaterialized())
 	{
-		CBucket *bucket = (*m_histogram_buckets)[ul];
-		buckets->Append(bucket->MakeBucketCopy(mp));
+		// share the column statistics instead of constructing the buckets
+		histogram_copy = GPOS_NEW(mp) CHistogram(mp, m_md_accessor, m_mdid_type, m_md_col_stats);
+		histogram_copy->m_null_freq = m_null_freq;
+		histogram_copy->m_distinct_remaining = m_distinct_remaining;
+		histogram_copy->m_freq_remaining = m_freq_remaining;
+		histogram_copy->m_is_col_stats_missing = false;
+	}
+	else
+	{
+		CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp);
+		for (ULONG ul = 0; ul < m_histogram_buckets->Size(); ul++)
+		{
+			CBucket *bucket = (*m_histogram_buckets)[ul];
+			buckets->Append(bucket->MakeBucketCopy(mp));
+		}
+
+		histogram_copy = GPOS_NEW(mp) CHistogram(buckets, m_is_well_defined, m_null_freq, m_distinct_remaining, m_freq_remaining);
+
+		// bucket copies have the same bounds
+		if (NULL != m_bounds)
+		{
+			m_bounds->AddRef();
+			histogram_copy->m_bounds = m_bounds;
+		}
 	}
 
-	CHistogram *histogram_copy = GPOS_NEW(mp) CHistogram(buckets, m_is_well_defined, m_null_freq, m_distinct_remaining, m_freq_remaining);
 	if (WereNDVsScaled())
 	{
 		histogram_copy->SetNDVScaled();
@@ -1121,8 +1300,8 @@ CHistogram::MakeJoinHistogramEqualityFilter
 	CBucketArray *join_buckets = GPOS_NEW(mp) CBucketArray(mp);
 	while (idx1 < buckets1 && idx2 < buckets2)
 	{
-		CBucket *bucket1 = (*m_histogram_buckets)[idx1];
-		CBucket *bucket2 = (*histogram->m_histogram_buckets)[idx2];
+		CBucket *bucket1 = (*GetBuckets())[idx1];
+		CBucket *bucket2 = (*histogram->GetBuckets())[idx2];
 
 		if (bucket1->Intersects(bucket2))
 		{
@@ -1398,10 +1577,10 @@ CHistogram::MakeGroupByHistogramNormalize
 
 	CBucketArray *new_buckets = GPOS_NEW(mp) CBucketArray(mp);
 
-	const ULONG num_of_buckets = m_histogram_buckets->Size();
+	const ULONG num_of_buckets = GetBuckets()->Size();
 	for (ULONG ul = 0; ul < num_of_buckets; ul++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[ul];
+		CBucket *bucket = (*GetBuckets())[ul];
 		CPoint *lower_bound = bucket->GetLowerBound();
 		CPoint *upper_bound = bucket->GetUpperBound();
 		lower_bound->AddRef();
@@ -1515,10 +1694,10 @@ CHistogram::MakeUnionAllHistogramNormalize
 	CleanupResidualBucket(bucket2, bucket2_is_residual);
 
 	// add any leftover buckets from other histogram
-	AddBuckets(mp, histogram->m_histogram_buckets, new_buckets, rows_other, rows_new, idx2, buckets2);
+	AddBuckets(mp, histogram->GetBuckets(), new_buckets, rows_other, rows_new, idx2, buckets2);
 
 	// add any leftover buckets from this histogram
-	AddBuckets(mp, m_histogram_buckets, new_buckets, rows, rows_new, idx1, buckets1);
+	AddBuckets(mp, GetBuckets(), new_buckets, rows, rows_new, idx1, buckets1);
 
 	CDouble new_null_freq = (m_null_freq * rows + histogram->m_null_freq * rows_other) / rows_new;
 
@@ -1714,10 +1893,10 @@ CHistogram::MakeUnionHistogramNormalize
 	CleanupResidualBucket(bucket2, bucket2_is_residual);
 
 	// add any leftover buckets from other histogram
-	AddBuckets(mp, other_histogram->m_histogram_buckets, histogram_buckets, rows_other, num_tuples_per_bucket, idx2, buckets2);
+	AddBuckets(mp, other_histogram->GetBuckets(), histogram_buckets, rows_other, num_tuples_per_bucket, idx2, buckets2);
 
 	// add any leftover buckets from this histogram
-	AddBuckets(mp, m_histogram_buckets, histogram_buckets, rows, num_tuples_per_bucket, idx1, buckets1);
+	AddBuckets(mp, GetBuckets(), histogram_buckets, rows, num_tuples_per_bucket, idx1, buckets1);
 
 	// compute the total number of null values from both histograms
 	CDouble num_null_rows = std::max( (this->GetNullFreq() * rows), (other_histogram->GetNullFreq() * rows_other));
@@ -1878,7 +2057,7 @@ CHistogram::operator []
 {
 	if (pos < Buckets())
 	{
-		return (*m_histogram_buckets) [pos];
+		return (*GetBuckets()) [pos];
 	}
 	return NULL;
 }
@@ -1896,10 +2075,10 @@ CHistogram::TranslateToDXLDerivedColumnStats
 {
 	CDXLBucketArray *dxl_stats_bucket_array = GPOS_NEW(mp) CDXLBucketArray(mp);
 
-	const ULONG num_of_buckets = m_histogram_buckets->Size();
+	const ULONG num_of_buckets = GetBuckets()->Size();
 	for (ULONG ul = 0; ul < num_of_buckets; ul++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[ul];
+		CBucket *bucket = (*GetBuckets())[ul];
 
 		CDouble freq = bucket->GetFrequency();
 		CDouble distinct = bucket->GetNumDistinct();
@@ -1931,14 +2110,14 @@ CHistogram::GetRandomBucketIndex
 	)
 	const
 {
-	const ULONG size = m_histogram_buckets->Size();
+	const ULONG size = GetBuckets()->Size();
 	GPOS_ASSERT(0 < size);
 
 	DOUBLE rand_val = ((DOUBLE) clib::Rand(seed)) / RAND_MAX;
 	CDouble accumulated_freq = 0;
 	for (ULONG ul = 0; ul < size - 1; ul++)
 	{
-		CBucket *bucket = (*m_histogram_buckets)[ul];
+		CBucket *bucket = (*GetBuckets())[ul];
 		accumulated_freq = accumulated_freq + bucket->GetFrequency();
 
 		// we compare generated random value with accumulated frequency,
@@ -1972,7 +2151,7 @@ CHistogram::ComputeSkew()
 {
 	m_skew_was_measured = true;
 
-	if (!IsNormalized() || 0 == m_histogram_buckets->Size() || !(*m_histogram_buckets)[0]->CanSample())
+	if (!IsNormalized() || 0 == GetBuckets()->Size() || !(*GetBuckets())[0]->CanSample())
 	{
 		return;
 	}
@@ -1988,7 +2167,7 @@ CHistogram::ComputeSkew()
 	for (ULONG ul = 0; ul < GPOPT_SKEW_SAMPLE_SIZE; ul++)
 	{
 		ULONG bucket_index = GetRandomBucketIndex(&seed);
-		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		CBucket *bucket = (*GetBuckets())[bucket_index];
 		samples[ul] = bucket->GetSample(&seed).Get();
 		sample_mean = sample_mean + samples[ul];
 	}
@@ -2176,9 +2355,9 @@ BOOL
 CHistogram::IsHistogramForTextRelatedTypes()
 const
 {
-	if (m_histogram_buckets->Size() > 0)
+	if (GetBuckets()->Size() > 0)
 	{
-		IMDId *mdid = (*m_histogram_buckets)[0]->GetLowerBound()->GetDatum()->MDId();
+		IMDId *mdid = (*GetBuckets())[0]->GetLowerBound()->GetDatum()->MDId();
 		return CStatsPredUtils::IsTextRelatedType(mdid);
 	}
 	return false;
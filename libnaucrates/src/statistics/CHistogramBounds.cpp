@@ -0,0 +1,322 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CHistogramBounds.cpp
+//
+//	@doc:
+//		Implementation of packed upper bounds of histogram buckets
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "naucrates/base/IDatumStatisticsMappable.h"
+#include "naucrates/statistics/CHistogramBounds.h"
+
+using namespace gpnaucrates;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHistogramBounds::CHistogramBounds
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CHistogramBounds::CHistogramBounds
+	(
+	IMemoryPool *mp,
+	const CBucketArray *buckets
+	)
+	:
+	m_mp(mp),
+	m_num_buckets(0),
+	m_is_lint_mapped(false),
+	m_upper_lint(NULL),
+	m_upper_double(NULL),
+	m_is_upper_closed(NULL),
+	m_datum(NULL)
+{
+	GPOS_ASSERT(NULL != buckets);
+
+	// bounds that cannot be packed leave the number of buckets at zero
+	(void) Pack(buckets);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHistogramBounds::~CHistogramBounds
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CHistogramBounds::~CHistogramBounds()
+{
+	GPOS_DELETE_ARRAY(m_upper_lint);
+	GPOS_DELETE_ARRAY(m_upper_double);
+	GPOS_DELETE_ARRAY(m_is_upper_closed);
+	CRefCount::SafeRelease(m_datum);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHistogramBounds::Pack
+//
+//	@doc:
+//		Pack the bounds of the given buckets. Bounds are visited in order,
+//		lower and upper bound of each bucket alternating, and must never
+//		decrease; a bucket may only have equal bounds if it is a singleton.
+//		With double mappings, bounds that are not identical must also be
+//		further apart than the tolerance of CDouble comparisons, so that
+//		no point compares equal to two different bounds
+//
+//---------------------------------------------------------------------------
+BOOL
+CHistogramBounds::Pack
+	(
+	const CBucketArray *buckets
+	)
+{
+	const ULONG num_buckets = buckets->Size();
+	if (0 == num_buckets)
+	{
+		return false;
+	}
+
+	IDatum *datum_first = (*buckets)[0]->GetLowerBound()->GetDatum();
+	IDatumStatisticsMappable *datum_mappable = dynamic_cast<IDatumStatisticsMappable *>(datum_first);
+	if (NULL == datum_mappable || !datum_mappable->IsDatumMappableToDouble())
+	{
+		return false;
+	}
+
+	m_is_lint_mapped = datum_mappable->IsDatumMappableToLINT();
+	IMDId *mdid = datum_first->MDId();
+
+	m_is_upper_closed = GPOS_NEW_ARRAY(m_mp, BOOL, num_buckets);
+	if (m_is_lint_mapped)
+	{
+		m_upper_lint = GPOS_NEW_ARRAY(m_mp, LINT, num_buckets);
+	}
+	else
+	{
+		m_upper_double = GPOS_NEW_ARRAY(m_mp, DOUBLE, num_buckets);
+	}
+
+	LINT prev_lint = 0;
+	DOUBLE prev_double = 0.0;
+	for (ULONG ul = 0; ul < 2 * num_buckets; ul++)
+	{
+		CBucket *bucket = (*buckets)[ul / 2];
+		BOOL is_lower = (0 == ul % 2);
+		CPoint *point = is_lower ? bucket->GetLowerBound() : bucket->GetUpperBound();
+		IDatumStatisticsMappable *datum = dynamic_cast<IDatumStatisticsMappable *>(point->GetDatum());
+
+		if (NULL == datum ||
+			datum->IsNull() ||
+			!datum->MDId()->Equals(mdid) ||
+			!datum->IsDatumMappableToDouble() ||
+			m_is_lint_mapped != datum->IsDatumMappableToLINT())
+		{
+			return false;
+		}
+
+		// equal bounds are only allowed at the end of a singleton bucket
+		// or where adjacent buckets touch
+		BOOL is_equal_allowed = is_lower || (bucket->IsLowerClosed() && bucket->IsUpperClosed());
+
+		if (m_is_lint_mapped)
+		{
+			LINT value = datum->GetLINTMapping();
+			if (0 < ul && (value < prev_lint || (value == prev_lint && !is_equal_allowed)))
+			{
+				return false;
+			}
+			prev_lint = value;
+
+			if (!is_lower)
+			{
+				m_upper_lint[ul / 2] = value;
+			}
+		}
+		else
+		{
+			DOUBLE value = datum->GetDoubleMapping().Get();
+			if (0 < ul &&
+				!(value - prev_double > 2 * GPOS_FP_ABS_MIN || (value == prev_double && is_equal_allowed)))
+			{
+				return false;
+			}
+			prev_double = value;
+
+			if (!is_lower)
+			{
+				m_upper_double[ul / 2] = value;
+			}
+		}
+
+		if (!is_lower)
+		{
+			m_is_upper_closed[ul / 2] = bucket->IsUpperClosed();
+		}
+	}
+
+	datum_first->AddRef();
+	m_datum = datum_first;
+	m_num_buckets = num_buckets;
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHistogramBounds::IsAfter
+//
+//	@doc:
+//		Is the point after the upper bound of the given bucket, following
+//		CBucket::IsAfter on LINT mappings
+//
+//---------------------------------------------------------------------------
+BOOL
+CHistogramBounds::IsAfter
+	(
+	ULONG bucket_index,
+	LINT value
+	)
+	const
+{
+	LINT upper = m_upper_lint[bucket_index];
+	if (m_is_upper_closed[bucket_index])
+	{
+		return upper < value;
+	}
+
+	return upper <= value;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHistogramBounds::IsAfter
+//
+//	@doc:
+//		Is the point after the upper bound of the given bucket, following
+//		CBucket::IsAfter on double mappings
+//
+//---------------------------------------------------------------------------
+BOOL
+CHistogramBounds::IsAfter
+	(
+	ULONG bucket_index,
+	CDouble value
+	)
+	const
+{
+	CDouble upper(m_upper_double[bucket_index]);
+	if (m_is_upper_closed[bucket_index])
+	{
+		return upper < value;
+	}
+
+	return upper < value || upper == value;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHistogramBounds::CanSearch
+//
+//	@doc:
+//		Can the buckets containing the given point be searched for; this is
+//		the case if the point compares to all bounds on the mapping they
+//		were packed with
+//
+//---------------------------------------------------------------------------
+BOOL
+CHistogramBounds::CanSearch
+	(
+	const CPoint *point
+	)
+	const
+{
+	GPOS_ASSERT(NULL != point);
+
+	if (!IsPacked())
+	{
+		return false;
+	}
+
+	IDatumStatisticsMappable *datum = dynamic_cast<IDatumStatisticsMappable *>(point->GetDatum());
+	if (NULL == datum || datum->IsNull() || !m_datum->StatsAreComparable(datum))
+	{
+		return false;
+	}
+
+	if (m_is_lint_mapped)
+	{
+		return datum->IsDatumMappableToLINT();
+	}
+
+	return datum->IsDatumMappableToDouble();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHistogramBounds::GetBucketIndex
+//
+//	@doc:
+//		Binary search for the first bucket the point is not after. Upper
+//		bounds never decrease, so the buckets the point is after form a
+//		prefix of the histogram
+//
+//---------------------------------------------------------------------------
+ULONG
+CHistogramBounds::GetBucketIndex
+	(
+	const CPoint *point
+	)
+	const
+{
+	GPOS_ASSERT(CanSearch(point));
+
+	IDatumStatisticsMappable *datum = dynamic_cast<IDatumStatisticsMappable *>(point->GetDatum());
+
+	ULONG low = 0;
+	ULONG high = m_num_buckets;
+	if (m_is_lint_mapped)
+	{
+		LINT value = datum->GetLINTMapping();
+		while (low < high)
+		{
+			ULONG mid = low + (high - low) / 2;
+			if (IsAfter(mid, value))
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid;
+			}
+		}
+
+		return low;
+	}
+
+	CDouble value = datum->GetDoubleMapping();
+	while (low < high)
+	{
+		ULONG mid = low + (high - low) / 2;
+		if (IsAfter(mid, value))
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+// EOF
@@ -0,0 +1,435 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLBinaryAttributes.cpp
+//
+//	@doc:
+//		Implementation of the attribute list of binary DXL elements
+//---------------------------------------------------------------------------
+
+#include "gpos/common/clibwrapper.h"
+
+#include "naucrates/dxl/xml/CDXLBinaryAttributes.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+using namespace gpdxl;
+
+// attributes of binary DXL documents have no namespace URI
+static const XMLCh xmlszEmpty[] = {0};
+
+// attributes of binary DXL documents are untyped
+static const XMLCh xmlszCDATA[] = {'C', 'D', 'A', 'T', 'A', 0};
+
+// initial number of attributes
+#define GPDXL_BINARY_ATTRIBUTES_INIT_CAPACITY 16
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::CDXLBinaryAttributes
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryAttributes::CDXLBinaryAttributes
+	(
+	IMemoryPool *mp
+	)
+	:
+	m_mp(mp),
+	m_names(NULL),
+	m_values(NULL),
+	m_size(0),
+	m_capacity(GPDXL_BINARY_ATTRIBUTES_INIT_CAPACITY)
+{
+	m_names = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_capacity);
+	m_values = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_capacity);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::~CDXLBinaryAttributes
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryAttributes::~CDXLBinaryAttributes()
+{
+	GPOS_DELETE_ARRAY(m_names);
+	GPOS_DELETE_ARRAY(m_values);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::Append
+//
+//	@doc:
+//		Add attribute, growing the name and value arrays if needed
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryAttributes::Append
+	(
+	const XMLCh *name,
+	const XMLCh *value
+	)
+{
+	GPOS_ASSERT(NULL != name);
+	GPOS_ASSERT(NULL != value);
+
+	if (m_size == m_capacity)
+	{
+		ULONG capacity = m_capacity * 2;
+		const XMLCh **names = GPOS_NEW_ARRAY(m_mp, const XMLCh *, capacity);
+		const XMLCh **values = GPOS_NEW_ARRAY(m_mp, const XMLCh *, capacity);
+		clib::Memcpy(names, m_names, m_size * GPOS_SIZEOF(const XMLCh *));
+		clib::Memcpy(values, m_values, m_size * GPOS_SIZEOF(const XMLCh *));
+
+		GPOS_DELETE_ARRAY(m_names);
+		GPOS_DELETE_ARRAY(m_values);
+		m_names = names;
+		m_values = values;
+		m_capacity = capacity;
+	}
+
+	m_names[m_size] = name;
+	m_values[m_size] = value;
+	m_size++;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::Find
+//
+//	@doc:
+//		Position of attribute with the given name; elements have few
+//		attributes, so a linear scan beats hashing
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryAttributes::Find
+	(
+	const XMLCh *name
+	)
+	const
+{
+	if (NULL == name)
+	{
+		return gpos::ulong_max;
+	}
+
+	for (ULONG ul = 0; ul < m_size; ul++)
+	{
+		if (m_names[ul][0] == name[0] && XMLString::equals(m_names[ul], name))
+		{
+			return ul;
+		}
+	}
+
+	return gpos::ulong_max;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getLength
+//
+//	@doc:
+//		Number of attributes
+//
+//---------------------------------------------------------------------------
+XMLSize_t
+CDXLBinaryAttributes::getLength() const
+{
+	return m_size;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getURI
+//
+//	@doc:
+//		Namespace URI of attribute at the given position
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getURI
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	if (index >= m_size)
+	{
+		return NULL;
+	}
+
+	return xmlszEmpty;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getLocalName
+//
+//	@doc:
+//		Local name of attribute at the given position
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getLocalName
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	return getQName(index);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getQName
+//
+//	@doc:
+//		Qualified name of attribute at the given position
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getQName
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	if (index >= m_size)
+	{
+		return NULL;
+	}
+
+	return m_names[index];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getType
+//
+//	@doc:
+//		Type of attribute at the given position
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getType
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	if (index >= m_size)
+	{
+		return NULL;
+	}
+
+	return xmlszCDATA;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getValue
+//
+//	@doc:
+//		Value of attribute at the given position
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getValue
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	if (index >= m_size)
+	{
+		return NULL;
+	}
+
+	return m_values[index];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getIndex
+//
+//	@doc:
+//		Position of attribute with the given namespace URI and local name
+//
+//---------------------------------------------------------------------------
+bool
+CDXLBinaryAttributes::getIndex
+	(
+	const XMLCh *const, // uri
+	const XMLCh *const local_part,
+	XMLSize_t &index
+	)
+	const
+{
+	return getIndex(local_part, index);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getIndex
+//
+//	@doc:
+//		Position of attribute with the given namespace URI and local name,
+//		-1 if not found
+//
+//---------------------------------------------------------------------------
+int
+CDXLBinaryAttributes::getIndex
+	(
+	const XMLCh *const, // uri
+	const XMLCh *const local_part
+	)
+	const
+{
+	return getIndex(local_part);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getIndex
+//
+//	@doc:
+//		Position of attribute with the given qualified name
+//
+//---------------------------------------------------------------------------
+bool
+CDXLBinaryAttributes::getIndex
+	(
+	const XMLCh *const qname,
+	XMLSize_t &index
+	)
+	const
+{
+	ULONG pos = Find(qname);
+	if (gpos::ulong_max == pos)
+	{
+		return false;
+	}
+
+	index = pos;
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getIndex
+//
+//	@doc:
+//		Position of attribute with the given qualified name, -1 if not found
+//
+//---------------------------------------------------------------------------
+int
+CDXLBinaryAttributes::getIndex
+	(
+	const XMLCh *const qname
+	)
+	const
+{
+	ULONG pos = Find(qname);
+	if (gpos::ulong_max == pos)
+	{
+		return -1;
+	}
+
+	return (int) pos;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getType
+//
+//	@doc:
+//		Type of attribute with the given namespace URI and local name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getType
+	(
+	const XMLCh *const, // uri
+	const XMLCh *const local_part
+	)
+	const
+{
+	return getType(local_part);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getType
+//
+//	@doc:
+//		Type of attribute with the given qualified name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getType
+	(
+	const XMLCh *const qname
+	)
+	const
+{
+	if (gpos::ulong_max == Find(qname))
+	{
+		return NULL;
+	}
+
+	return xmlszCDATA;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getValue
+//
+//	@doc:
+//		Value of attribute with the given qualified name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getValue
+	(
+	const XMLCh *const qname
+	)
+	const
+{
+	ULONG pos = Find(qname);
+	if (gpos::ulong_max == pos)
+	{
+		return NULL;
+	}
+
+	return m_values[pos];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::getValue
+//
+//	@doc:
+//		Value of attribute with the given namespace URI and local name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryAttributes::getValue
+	(
+	const XMLCh *const, // uri
+	const XMLCh *const local_part
+	)
+	const
+{
+	return getValue(local_part);
+}
+
+// EOF
@@ -0,0 +1,366 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLBinaryReader.cpp
+//
+//	@doc:
+//		Implementation of the reader of binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "gpos/common/clibwrapper.h"
+
+#include "naucrates/exception.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+#include "naucrates/dxl/xml/CDXLBinarySerializer.h"
+#include "naucrates/dxl/xml/dxltokens.h"
+
+using namespace gpdxl;
+
+// initial size of name table and element stack
+#define GPDXL_BINARY_READER_INIT_CAPACITY 64
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CDXLBinaryReader
+//
+//	@doc:
+//		Ctor; strings are read in place, so a document that is not aligned
+//		for XMLCh access is copied first
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::CDXLBinaryReader
+	(
+	IMemoryPool *mp,
+	const BYTE *buffer,
+	ULONG size
+	)
+	:
+	m_mp(mp),
+	m_buffer(buffer),
+	m_size(size),
+	m_aligned_buffer(NULL),
+	m_offset(0),
+	m_content_handler(NULL),
+	m_names(NULL),
+	m_num_names(0),
+	m_names_capacity(GPDXL_BINARY_READER_INIT_CAPACITY),
+	m_elements(NULL),
+	m_depth(0),
+	m_elements_capacity(GPDXL_BINARY_READER_INIT_CAPACITY),
+	m_attrs(mp)
+{
+	GPOS_ASSERT(NULL != buffer || 0 == size);
+
+	if (0 != ((ULONG_PTR) buffer) % GPOS_SIZEOF(XMLCh))
+	{
+		m_aligned_buffer = GPOS_NEW_ARRAY(m_mp, BYTE, size);
+		clib::Memcpy(m_aligned_buffer, buffer, size);
+		m_buffer = m_aligned_buffer;
+	}
+
+	m_names = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_names_capacity);
+	m_elements = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_elements_capacity);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::~CDXLBinaryReader
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::~CDXLBinaryReader()
+{
+	GPOS_DELETE_ARRAY(m_names);
+	GPOS_DELETE_ARRAY(m_elements);
+	GPOS_DELETE_ARRAY(m_aligned_buffer);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::IsBinaryDXL
+//
+//	@doc:
+//		Does the given buffer start with a binary DXL header
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLBinaryReader::IsBinaryDXL
+	(
+	const BYTE *buffer,
+	ULONG size
+	)
+{
+	ULONG header[2];
+	if (NULL == buffer || size < GPOS_SIZEOF(header))
+	{
+		return false;
+	}
+
+	clib::Memcpy(header, buffer, GPOS_SIZEOF(header));
+	return GPDXL_BINARY_MAGIC == header[0];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::RaiseError
+//
+//	@doc:
+//		Raise a parse error at the current read position
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::RaiseError() const
+{
+	GPOS_RAISE(ExmaDXL, ExmiDXLBinaryParseError, m_offset);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadByte
+//
+//	@doc:
+//		Read raw byte
+//
+//---------------------------------------------------------------------------
+BYTE
+CDXLBinaryReader::ReadByte()
+{
+	if (m_offset >= m_size)
+	{
+		RaiseError();
+	}
+
+	return m_buffer[m_offset++];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadVarint
+//
+//	@doc:
+//		Read variable-length integer
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryReader::ReadVarint()
+{
+	ULONG value = 0;
+	for (ULONG shift = 0; shift < 32; shift += 7)
+	{
+		BYTE byte = ReadByte();
+		value |= ((ULONG) (byte & 0x7F)) << shift;
+		if (0 == (byte & 0x80))
+		{
+			return value;
+		}
+	}
+
+	// more than five bytes
+	RaiseError();
+	return 0;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadString
+//
+//	@doc:
+//		Read string in place after verifying it fits the document and is
+//		NUL-terminated
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::ReadString()
+{
+	ULONG length = ReadVarint();
+
+	m_offset += m_offset % GPOS_SIZEOF(XMLCh);
+
+	if (m_offset > m_size || (m_size - m_offset) / GPOS_SIZEOF(XMLCh) <= length)
+	{
+		RaiseError();
+	}
+
+	const XMLCh *xmlsz = (const XMLCh *) (m_buffer + m_offset);
+	if (0 != xmlsz[length])
+	{
+		RaiseError();
+	}
+
+	m_offset += (length + 1) * GPOS_SIZEOF(XMLCh);
+
+	return xmlsz;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Append
+//
+//	@doc:
+//		Append to an array of names, growing it if needed
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Append
+	(
+	const XMLCh ***names,
+	ULONG *size,
+	ULONG *capacity,
+	const XMLCh *name
+	)
+{
+	if (*size == *capacity)
+	{
+		const XMLCh **new_names = GPOS_NEW_ARRAY(m_mp, const XMLCh *, *capacity * 2);
+		clib::Memcpy(new_names, *names, *size * GPOS_SIZEOF(const XMLCh *));
+		GPOS_DELETE_ARRAY(*names);
+
+		*names = new_names;
+		*capacity *= 2;
+	}
+
+	(*names)[(*size)++] = name;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadName
+//
+//	@doc:
+//		Read name reference; reference 0 introduces a new name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::ReadName()
+{
+	ULONG ref = ReadVarint();
+	if (0 == ref)
+	{
+		const XMLCh *name = ReadString();
+		Append(&m_names, &m_num_names, &m_names_capacity, name);
+
+		return name;
+	}
+
+	if (ref > m_num_names)
+	{
+		RaiseError();
+	}
+
+	return m_names[ref - 1];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadAttributes
+//
+//	@doc:
+//		Read the attribute records following a start element record
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::ReadAttributes()
+{
+	m_attrs.Clear();
+
+	while (m_offset < m_size && CDXLBinarySerializer::ErecAttribute == m_buffer[m_offset])
+	{
+		m_offset++;
+
+		const XMLCh *name = ReadName();
+		const XMLCh *value = ReadString();
+		m_attrs.Append(name, value);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Parse
+//
+//	@doc:
+//		Read the whole document and deliver its events to the current
+//		content handler
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Parse()
+{
+	GPOS_ASSERT(NULL != m_content_handler);
+
+	if (!IsBinaryDXL(m_buffer, m_size))
+	{
+		RaiseError();
+	}
+
+	ULONG header[2];
+	clib::Memcpy(header, m_buffer, GPOS_SIZEOF(header));
+	m_offset = GPOS_SIZEOF(header);
+	if (GPDXL_BINARY_VERSION != header[1])
+	{
+		RaiseError();
+	}
+
+	const XMLCh *uri = CDXLTokens::XmlstrToken(EdxltokenNamespaceURI);
+
+	m_content_handler->startDocument();
+
+	while (true)
+	{
+		BYTE record = ReadByte();
+		if (NULL == m_content_handler && CDXLBinarySerializer::ErecEndDocument != record)
+		{
+			// the last handler deactivated itself before the end of the document
+			RaiseError();
+		}
+
+		switch (record)
+		{
+			case CDXLBinarySerializer::ErecStartElement:
+			{
+				const XMLCh *name = ReadName();
+				ReadAttributes();
+				Append(&m_elements, &m_depth, &m_elements_capacity, name);
+
+				m_content_handler->startElement(uri, name, name, m_attrs);
+				break;
+			}
+
+			case CDXLBinarySerializer::ErecEndElement:
+			{
+				if (0 == m_depth)
+				{
+					RaiseError();
+				}
+
+				const XMLCh *name = m_elements[--m_depth];
+				m_content_handler->endElement(uri, name, name);
+				break;
+			}
+
+			case CDXLBinarySerializer::ErecEndDocument:
+			{
+				if (0 != m_depth || m_offset != m_size)
+				{
+					RaiseError();
+				}
+
+				// content handler may have been reset by the last end element
+				if (NULL != m_content_handler)
+				{
+					m_content_handler->endDocument();
+				}
+				return;
+			}
+
+			default:
+				// attribute records are only valid after a start element
+				RaiseError();
+		}
+	}
+}
+
+// EOF
@@ -0,0 +1,540 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLBinarySerializer.cpp
+//
+//	@doc:
+//		Implementation of the serializer for binary DXL documents
+//---------------------------------------------------------------------------
+
+#include <xercesc/util/XercesDefs.hpp>
+
+#include "gpos/common/clibwrapper.h"
+
+#include "naucrates/dxl/xml/CDXLBinarySerializer.h"
+#include "naucrates/dxl/xml/dxltokens.h"
+
+using namespace gpdxl;
+
+XERCES_CPP_NAMESPACE_USE
+
+// initial size of output buffer
+#define GPDXL_BINARY_INIT_CAPACITY 1024
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::CDXLBinarySerializer
+//
+//	@doc:
+//		Ctor; writes the document header
+//
+//---------------------------------------------------------------------------
+CDXLBinarySerializer::CDXLBinarySerializer
+	(
+	IMemoryPool *mp
+	)
+	:
+	CXMLSerializer(mp, m_value_os, false /*indentation*/),
+	m_mp(mp),
+	m_value_str(mp),
+	m_value_os(&m_value_str),
+	m_buffer(NULL),
+	m_size(0),
+	m_capacity(0),
+	m_names(NULL),
+	m_depth(0)
+{
+	m_names = GPOS_NEW(mp) NameToIndexMap(mp);
+
+	const ULONG header[] = {GPDXL_BINARY_MAGIC, GPDXL_BINARY_VERSION};
+	WriteBytes(header, GPOS_SIZEOF(header));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::~CDXLBinarySerializer
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinarySerializer::~CDXLBinarySerializer()
+{
+	m_names->Release();
+	GPOS_DELETE_ARRAY(m_buffer);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::HashName
+//
+//	@doc:
+//		Hash function of names
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinarySerializer::HashName
+	(
+	const CWStringConst *str
+	)
+{
+	return gpos::HashByteArray((const BYTE *) str->GetBuffer(), str->Length() * GPOS_SIZEOF(WCHAR));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::EqualsName
+//
+//	@doc:
+//		Equality function of names
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLBinarySerializer::EqualsName
+	(
+	const CWStringConst *str_fst,
+	const CWStringConst *str_snd
+	)
+{
+	return str_fst->Equals(str_snd);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::Reserve
+//
+//	@doc:
+//		Grow output buffer geometrically to hold the given number of
+//		additional bytes
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::Reserve
+	(
+	ULONG num_bytes
+	)
+{
+	if (m_size + num_bytes <= m_capacity)
+	{
+		return;
+	}
+
+	ULONG capacity = std::max((ULONG) GPDXL_BINARY_INIT_CAPACITY, m_capacity);
+	while (capacity < m_size + num_bytes)
+	{
+		capacity *= 2;
+	}
+
+	BYTE *buffer = GPOS_NEW_ARRAY(m_mp, BYTE, capacity);
+	if (0 < m_size)
+	{
+		clib::Memcpy(buffer, m_buffer, m_size);
+	}
+
+	GPOS_DELETE_ARRAY(m_buffer);
+	m_buffer = buffer;
+	m_capacity = capacity;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::WriteBytes
+//
+//	@doc:
+//		Append raw bytes
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::WriteBytes
+	(
+	const void *data,
+	ULONG num_bytes
+	)
+{
+	Reserve(num_bytes);
+	clib::Memcpy(m_buffer + m_size, data, num_bytes);
+	m_size += num_bytes;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::WriteVarint
+//
+//	@doc:
+//		Append variable-length integer, seven bits per byte starting with
+//		the least significant ones; the high bit marks continuation
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::WriteVarint
+	(
+	ULONG value
+	)
+{
+	Reserve(5);
+	while (0x80 <= value)
+	{
+		m_buffer[m_size++] = (BYTE) (value | 0x80);
+		value >>= 7;
+	}
+	m_buffer[m_size++] = (BYTE) value;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::WriteString
+//
+//	@doc:
+//		Append string as its length in XMLCh units followed by the padding
+//		needed to align the XMLCh array and the NUL-terminated array itself;
+//		characters outside the basic multilingual plane become surrogate
+//		pairs
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::WriteString
+	(
+	const WCHAR *wsz,
+	ULONG length
+	)
+{
+	ULONG xml_length = length;
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		if (0xFFFF < (ULONG) wsz[ul])
+		{
+			xml_length++;
+		}
+	}
+
+	WriteVarint(xml_length);
+
+	Reserve(GPOS_SIZEOF(XMLCh) + (xml_length + 1) * GPOS_SIZEOF(XMLCh));
+	while (0 != m_size % GPOS_SIZEOF(XMLCh))
+	{
+		m_buffer[m_size++] = 0;
+	}
+
+	XMLCh *xmlsz = (XMLCh *) (m_buffer + m_size);
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		ULONG code_point = (ULONG) wsz[ul];
+		if (0xFFFF < code_point)
+		{
+			code_point -= 0x10000;
+			*xmlsz++ = (XMLCh) (0xD800 + (code_point >> 10));
+			*xmlsz++ = (XMLCh) (0xDC00 + (code_point & 0x3FF));
+		}
+		else
+		{
+			*xmlsz++ = (XMLCh) code_point;
+		}
+	}
+	*xmlsz = 0;
+
+	m_size += (xml_length + 1) * GPOS_SIZEOF(XMLCh);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::WriteName
+//
+//	@doc:
+//		Append reference to a name; names seen for the first time are
+//		written as reference 0 followed by the name, and are referenced by
+//		their 1-based position in the document afterwards
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::WriteName
+	(
+	const CWStringBase *str
+	)
+{
+	CWStringConst name(str->GetBuffer());
+	const ULONG *index = m_names->Find(&name);
+	if (NULL != index)
+	{
+		WriteVarint(*index);
+		return;
+	}
+
+	ULONG new_index = m_names->Size() + 1;
+	m_names->Insert(GPOS_NEW(m_mp) CWStringConst(m_mp, str->GetBuffer()), GPOS_NEW(m_mp) ULONG(new_index));
+
+	WriteVarint(0);
+	WriteString(str->GetBuffer(), str->Length());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::CopyBuffer
+//
+//	@doc:
+//		Copy of serialized document allocated in the given memory pool
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLBinarySerializer::CopyBuffer
+	(
+	IMemoryPool *mp
+	)
+	const
+{
+	BYTE *buffer = GPOS_NEW_ARRAY(mp, BYTE, m_size);
+	clib::Memcpy(buffer, m_buffer, m_size);
+
+	return buffer;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::StartDocument
+//
+//	@doc:
+//		Binary documents have no XML declaration, the header is written
+//		on construction
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::StartDocument()
+{
+	GPOS_ASSERT(0 == m_depth);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::EndDocument
+//
+//	@doc:
+//		Finish the document
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::EndDocument()
+{
+	GPOS_ASSERT(0 == m_depth);
+
+	const BYTE record = ErecEndDocument;
+	WriteBytes(&record, 1);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::OpenElement
+//
+//	@doc:
+//		Start a new element; the namespace is implied
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::OpenElement
+	(
+	const CWStringBase *, // pstrNamespace
+	const CWStringBase *elem_str
+	)
+{
+	GPOS_ASSERT(NULL != elem_str);
+
+	const BYTE record = ErecStartElement;
+	WriteBytes(&record, 1);
+	WriteName(elem_str);
+
+	m_depth++;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::CloseElement
+//
+//	@doc:
+//		End the innermost open element
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::CloseElement
+	(
+	const CWStringBase *, // pstrNamespace
+	const CWStringBase * // elem_str
+	)
+{
+	GPOS_ASSERT(0 < m_depth);
+
+	const BYTE record = ErecEndElement;
+	WriteBytes(&record, 1);
+
+	m_depth--;
+
+	GPOS_CHECK_ABORT;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::AddAttribute
+//
+//	@doc:
+//		Add string-valued attribute to the last started element; namespace
+//		declarations are implied by binary documents and skipped
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::AddAttribute
+	(
+	const CWStringBase *pstrAttr,
+	const CWStringBase *str_value
+	)
+{
+	GPOS_ASSERT(NULL != pstrAttr);
+	GPOS_ASSERT(NULL != str_value);
+	GPOS_ASSERT(0 < m_depth);
+
+	const CWStringConst *namespace_attr_str = CDXLTokens::GetDXLTokenStr(EdxltokenNamespaceAttr);
+	if (0 == clib::Wcsncmp(pstrAttr->GetBuffer(), namespace_attr_str->GetBuffer(), namespace_attr_str->Length()))
+	{
+		return;
+	}
+
+	const BYTE record = ErecAttribute;
+	WriteBytes(&record, 1);
+	WriteName(pstrAttr);
+	WriteString(str_value->GetBuffer(), str_value->Length());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::WriteFormattedAttribute
+//
+//	@doc:
+//		Add attribute with the value formatted in the scratch string, and
+//		reset the scratch string
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::WriteFormattedAttribute
+	(
+	const CWStringBase *pstrAttr
+	)
+{
+	AddAttribute(pstrAttr, &m_value_str);
+	m_value_str.Reset();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::AddAttribute
+//
+//	@doc:
+//		Add character string attribute
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::AddAttribute
+	(
+	const CWStringBase *pstrAttr,
+	const CHAR *szValue
+	)
+{
+	GPOS_ASSERT(NULL != szValue);
+
+	m_value_os << szValue;
+	WriteFormattedAttribute(pstrAttr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::AddAttribute
+//
+//	@doc:
+//		Add unsigned integer-valued attribute
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::AddAttribute
+	(
+	const CWStringBase *pstrAttr,
+	ULONG ulValue
+	)
+{
+	m_value_os << ulValue;
+	WriteFormattedAttribute(pstrAttr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::AddAttribute
+//
+//	@doc:
+//		Add unsigned long integer-valued attribute
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::AddAttribute
+	(
+	const CWStringBase *pstrAttr,
+	ULLONG ullValue
+	)
+{
+	m_value_os << ullValue;
+	WriteFormattedAttribute(pstrAttr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::AddAttribute
+//
+//	@doc:
+//		Add integer-valued attribute
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::AddAttribute
+	(
+	const CWStringBase *pstrAttr,
+	INT iValue
+	)
+{
+	m_value_os << iValue;
+	WriteFormattedAttribute(pstrAttr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::AddAttribute
+//
+//	@doc:
+//		Add long integer-valued attribute
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::AddAttribute
+	(
+	const CWStringBase *pstrAttr,
+	LINT value
+	)
+{
+	m_value_os << value;
+	WriteFormattedAttribute(pstrAttr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinarySerializer::AddAttribute
+//
+//	@doc:
+//		Add double-valued attribute
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinarySerializer::AddAttribute
+	(
+	const CWStringBase *pstrAttr,
+	CDouble value
+	)
+{
+	m_value_os << value;
+	WriteFormattedAttribute(pstrAttr);
+}
+
+// EOF
@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLEventSerializer.cpp
+//
+//	@doc:
+//		Implementation of the content handler writing SAX events to a
+//		serializer
+//---------------------------------------------------------------------------
+
+#include "gpos/common/clibwrapper.h"
+#include "gpos/string/CWStringConst.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/xml/CDXLEventSerializer.h"
+#include "naucrates/dxl/xml/dxltokens.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+using namespace gpdxl;
+
+// initial size of scratch buffers
+#define GPDXL_EVENT_SERIALIZER_INIT_CAPACITY 64
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::CDXLEventSerializer
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLEventSerializer::CDXLEventSerializer
+	(
+	IMemoryPool *mp,
+	CXMLSerializer *xml_serializer
+	)
+	:
+	m_mp(mp),
+	m_xml_serializer(xml_serializer),
+	m_name(NULL),
+	m_name_capacity(GPDXL_EVENT_SERIALIZER_INIT_CAPACITY),
+	m_value(NULL),
+	m_value_capacity(GPDXL_EVENT_SERIALIZER_INIT_CAPACITY),
+	m_depth(0),
+	m_element_names(NULL)
+{
+	GPOS_ASSERT(NULL != xml_serializer);
+
+	m_element_names = GPOS_NEW(m_mp) NameMap(m_mp);
+
+	m_name = GPOS_NEW_ARRAY(m_mp, WCHAR, m_name_capacity);
+	m_value = GPOS_NEW_ARRAY(m_mp, WCHAR, m_value_capacity);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::~CDXLEventSerializer
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLEventSerializer::~CDXLEventSerializer()
+{
+	GPOS_DELETE_ARRAY(m_name);
+	GPOS_DELETE_ARRAY(m_value);
+	m_element_names->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::HashName
+//
+//	@doc:
+//		Hash function of names
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLEventSerializer::HashName
+	(
+	const CWStringConst *str
+	)
+{
+	return gpos::HashByteArray((const BYTE *) str->GetBuffer(), str->Length() * GPOS_SIZEOF(WCHAR));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::EqualsName
+//
+//	@doc:
+//		Equality function of names
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLEventSerializer::EqualsName
+	(
+	const CWStringConst *str_fst,
+	const CWStringConst *str_snd
+	)
+{
+	return str_fst->Equals(str_snd);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::Convert
+//
+//	@doc:
+//		Convert UTF-16 Xerces string into the given scratch buffer, growing
+//		it if needed
+//
+//---------------------------------------------------------------------------
+const WCHAR *
+CDXLEventSerializer::Convert
+	(
+	const XMLCh *xmlsz,
+	WCHAR **buffer,
+	ULONG *capacity
+	)
+{
+	const ULONG length = (ULONG) XMLString::stringLen(xmlsz);
+	if (*capacity <= length)
+	{
+		GPOS_DELETE_ARRAY(*buffer);
+		*capacity = length + 1;
+		*buffer = GPOS_NEW_ARRAY(m_mp, WCHAR, *capacity);
+	}
+
+	WCHAR *wsz = *buffer;
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		ULONG code_unit = xmlsz[ul];
+		if (0xD800 <= code_unit && code_unit < 0xDC00 && ul + 1 < length)
+		{
+			ULONG low_surrogate = xmlsz[ul + 1];
+			if (0xDC00 <= low_surrogate && low_surrogate < 0xE000)
+			{
+				code_unit = 0x10000 + ((code_unit - 0xD800) << 10) + (low_surrogate - 0xDC00);
+				ul++;
+			}
+		}
+		*wsz++ = (WCHAR) code_unit;
+	}
+	*wsz = WCHAR_EOS;
+
+	return *buffer;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::GetElementName
+//
+//	@doc:
+//		Element name that stays valid for the lifetime of the handler; DXL
+//		documents use few distinct element names, so they are interned
+//
+//---------------------------------------------------------------------------
+const CWStringConst *
+CDXLEventSerializer::GetElementName
+	(
+	const XMLCh *xmlsz
+	)
+{
+	CWStringConst name_str(Convert(xmlsz, &m_name, &m_name_capacity));
+
+	const CWStringConst *interned_str = m_element_names->Find(&name_str);
+	if (NULL == interned_str)
+	{
+		CWStringConst *new_str = GPOS_NEW(m_mp) CWStringConst(m_mp, name_str.GetBuffer());
+		m_element_names->Insert(new_str, new_str);
+		interned_str = new_str;
+	}
+
+	return interned_str;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::startDocument
+//
+//	@doc:
+//		Start the document
+//
+//---------------------------------------------------------------------------
+void
+CDXLEventSerializer::startDocument()
+{
+	m_xml_serializer->StartDocument();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::startElement
+//
+//	@doc:
+//		Write element with its attributes
+//
+//---------------------------------------------------------------------------
+void
+CDXLEventSerializer::startElement
+	(
+	const XMLCh *const, // element_uri,
+	const XMLCh *const element_local_name,
+	const XMLCh *const, // element_qname,
+	const Attributes &attrs
+	)
+{
+	const CWStringConst *namespace_prefix_str = CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix);
+	const CWStringConst *namespace_attr_str = CDXLTokens::GetDXLTokenStr(EdxltokenNamespaceAttr);
+
+	m_xml_serializer->OpenElement(namespace_prefix_str, GetElementName(element_local_name));
+
+	if (0 == m_depth)
+	{
+		CWStringDynamic namespace_specification_string(m_mp);
+		namespace_specification_string.AppendFormat
+							(
+							GPOS_WSZ_LIT("%ls%ls%ls"),
+							namespace_attr_str->GetBuffer(),
+							CDXLTokens::GetDXLTokenStr(EdxltokenColon)->GetBuffer(),
+							namespace_prefix_str->GetBuffer()
+							);
+		m_xml_serializer->AddAttribute(&namespace_specification_string, CDXLTokens::GetDXLTokenStr(EdxltokenNamespaceURI));
+	}
+
+	const ULONG num_attrs = (ULONG) attrs.getLength();
+	for (ULONG ul = 0; ul < num_attrs; ul++)
+	{
+		CWStringConst attr_name_str(Convert(attrs.getQName(ul), &m_name, &m_name_capacity));
+		if (0 == clib::Wcsncmp(attr_name_str.GetBuffer(), namespace_attr_str->GetBuffer(), namespace_attr_str->Length()))
+		{
+			continue;
+		}
+
+		CWStringConst attr_value_str(Convert(attrs.getValue(ul), &m_value, &m_value_capacity));
+		m_xml_serializer->AddAttribute(&attr_name_str, &attr_value_str);
+	}
+
+	m_depth++;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLEventSerializer::endElement
+//
+//	@doc:
+//		Close element
+//
+//---------------------------------------------------------------------------
+void
+CDXLEventSerializer::endElement
+	(
+	const XMLCh *const, // element_uri,
+	const XMLCh *const element_local_name,
+	const XMLCh *const // element_qname
+	)
+{
+	GPOS_ASSERT(0 < m_depth);
+
+	m_xml_serializer->CloseElement(CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), GetElementName(element_local_name));
+
+	m_depth--;
+}
+
+// EOF
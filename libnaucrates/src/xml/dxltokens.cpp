@@ -69,6 +69,7 @@ CDXLTokens::Init
 			{EdxltokenY, GPOS_WSZ_LIT("Y")},
 
 			{EdxltokenOptimizerConfig, GPOS_WSZ_LIT("OptimizerConfig")},
+			{EdxltokenOptimizationBudget, GPOS_WSZ_LIT("OptimizationBudget")},
 			{EdxltokenEnumeratorConfig, GPOS_WSZ_LIT("EnumeratorConfig")},
 			{EdxltokenStatisticsConfig, GPOS_WSZ_LIT("StatisticsConfig")},
 			{EdxltokenDampingFactorFilter, GPOS_WSZ_LIT("DampingFactorFilter")},
@@ -86,6 +87,15 @@ CDXLTokens::Init
 			{EdxltokenJoinOrderDPThreshold, GPOS_WSZ_LIT("JoinOrderDynamicProgThreshold")},
 			{EdxltokenBroadcastThreshold, GPOS_WSZ_LIT("BroadcastThreshold")},
 			{EdxltokenEnforceConstraintsOnDML, GPOS_WSZ_LIT("EnforceConstraintsOnDML")},
+			{EdxltokenSchedulerConfig, GPOS_WSZ_LIT("SchedulerConfig")},
+			{EdxltokenSchedulingPolicy, GPOS_WSZ_LIT("SchedulingPolicy")},
+			{EdxltokenSchedulingPolicySharedQueue, GPOS_WSZ_LIT("SharedQueue")},
+			{EdxltokenSchedulingPolicyWorkStealing, GPOS_WSZ_LIT("WorkStealing")},
+			{EdxltokenSchedulingPolicyPriority, GPOS_WSZ_LIT("Priority")},
+			{EdxltokenWorkerPolicy, GPOS_WSZ_LIT("WorkerPolicy")},
+			{EdxltokenWorkerPolicyQueuedRunningRatio, GPOS_WSZ_LIT("QueuedRunningRatio")},
+			{EdxltokenWorkerPolicyAdaptive, GPOS_WSZ_LIT("Adaptive")},
+			{EdxltokenSchedulerWorkers, GPOS_WSZ_LIT("Workers")},
 			{EdxltokenWindowOids, GPOS_WSZ_LIT("WindowOids")},
 			{EdxltokenOidRowNumber, GPOS_WSZ_LIT("RowNumber")},
 			{EdxltokenOidRank, GPOS_WSZ_LIT("Rank")},
@@ -0,0 +1,56 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal Software, Inc.
+//
+//	@filename:
+//		CDXLBinaryTest.h
+//
+//	@doc:
+//		Tests binary DXL serialization and parsing
+//---------------------------------------------------------------------------
+
+
+#ifndef GPDXL_CDXLBinaryTest_H
+#define GPDXL_CDXLBinaryTest_H
+
+#include "gpos/base.h"
+
+namespace gpdxl
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CDXLBinaryTest
+	//
+	//	@doc:
+	//		Static unit tests
+	//
+	//---------------------------------------------------------------------------
+	class CDXLBinaryTest
+	{
+		private:
+
+			// round-trip the given DXL file through the binary format
+			static
+			BOOL FRoundTrip(IMemoryPool *mp, const CHAR *szFileName);
+
+			// round-trip all DXL files in the given directory and its subdirectories
+			static
+			void RoundTripDirectory(IMemoryPool *mp, const CHAR *szDir, ULONG *pulFiles, ULONG *pulFailures);
+
+		public:
+
+			// unittests
+			static GPOS_RESULT EresUnittest();
+			static GPOS_RESULT EresUnittest_Basic();
+			static GPOS_RESULT EresUnittest_Malformed();
+			static GPOS_RESULT EresUnittest_RoundTripAll();
+			static GPOS_RESULT EresUnittest_ParseThroughput();
+
+	}; // class CDXLBinaryTest
+}
+
+#endif // !GPDXL_CDXLBinaryTest_H
+
+// EOF
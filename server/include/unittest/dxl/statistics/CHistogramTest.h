@@ -33,6 +33,38 @@ namespace gpnaucrates
 			static
 			CHistogram* PhistExampleInt4Remain(IMemoryPool *mp);
 
+			// generate int histogram with many buckets, some of them singletons
+			static
+			CHistogram* PhistWideInt4(IMemoryPool *mp);
+
+			// generate numeric histogram with many buckets
+			static
+			CHistogram* PhistWideNumeric(IMemoryPool *mp);
+
+			// check that filtering with and without searching the bucket bounds
+			// gives the same histogram; return the time taken by each
+			static
+			void CheckBoundsSearch
+				(
+				IMemoryPool *mp,
+				const CHistogram *histogram,
+				CStatsPred::EStatsCmpType stats_cmp_type,
+				CPoint *point,
+				ULONG *pulSearchTime,
+				ULONG *pulScanTime
+				);
+
+			// filter the given histogram with each comparison type and point
+			static
+			void BenchmarkBoundsSearch
+				(
+				IMemoryPool *mp,
+				const char *szName,
+				const CHistogram *histogram,
+				CPoint **rgppoint,
+				ULONG ulPoints
+				);
+
 		public:
 
 			// unittests
@@ -53,6 +85,10 @@ namespace gpnaucrates
 			static
 			GPOS_RESULT EresUnittest_Skew();
 
+			// binary search of bucket bounds in filters
+			static
+			GPOS_RESULT EresUnittest_BoundsSearch();
+
 	}; // class CHistogramTest
 }
 
@@ -44,6 +44,14 @@ namespace gpopt
 			// task that creates a MD accessor and starts multiple threads which
 			// lookup MD objects through that accessor
 			static void *PvInitMDAAndLookup(void *pv);
+
+			// optimize a test query using the given provider, return elapsed
+			// time in microseconds
+			static ULONG UlTimeToFirstPlan(IMemoryPool *mp, CMDProviderMemory *pmdp);
+
+			// construct eager and lazy histograms for all column stats objects
+			// of a minidump; return the bytes allocated for each kind
+			static void HistogramBytes(IMemoryPool *mp, const CHAR *szFileName, ULLONG *pullEager, ULLONG *pullLazy);
 			
 			// cache task function pointer
 			typedef void * (*TaskFuncPtr)(void *);
@@ -82,6 +90,8 @@ namespace gpopt
 			static GPOS_RESULT EresUnittest_ConcurrentAccessSingleMDA();
 			static GPOS_RESULT EresUnittest_ConcurrentAccessMultipleMDA();
 			static GPOS_RESULT EresUnittest_PrematureMDIdRelease();
+			static GPOS_RESULT EresUnittest_Snapshot();
+			static GPOS_RESULT EresUnittest_LazyHistograms();
 
 	}; // class CMDAccessorTest
 }
@@ -98,6 +98,14 @@ namespace gpopt
 			static
 			GPOS_RESULT EresUnittest_RunTestsWithoutAdditionalTraceFlags();
 
+			// test that a plan is returned once the optimization budget runs out
+			static
+			GPOS_RESULT EresUnittest_OptimizationBudget();
+
+			// test that the priority scheduling policy produces the expected plans
+			static
+			GPOS_RESULT EresUnittest_PriorityScheduling();
+
 	}; // class CICGTest
 }
 
@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2018 Pivotal, Inc.
+//
+//	@filename:
+//		CMemoTest.h
+//
+//	@doc:
+//		Test for memo group expression index
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CMemoTest_H
+#define GPOPT_CMemoTest_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+
+#include "gpopt/search/CGroupExpression.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CMemoTest
+	//
+	//	@doc:
+	//		Unittests for memo group expression index
+	//
+	//---------------------------------------------------------------------------
+	class CMemoTest
+	{
+		private:
+
+			// array of group expressions
+			typedef CDynamicPtrArray<CGroupExpression, CleanupNULL> CGroupExpressionArray;
+
+			//---------------------------------------------------------------------------
+			//	@class:
+			//		SGExprEntry
+			//
+			//	@doc:
+			//		Hash table entry wrapping a group expression owned by a memo,
+			//		so that the group expression's own memo link is not touched
+			//
+			//---------------------------------------------------------------------------
+			struct SGExprEntry
+			{
+				// wrapped group expression
+				CGroupExpression *m_pgexpr;
+
+				// generic link
+				SLink m_link;
+
+				// invalid entry
+				static
+				const SGExprEntry m_gexprentryInvalid;
+
+				// ctor
+				SGExprEntry()
+					:
+					m_pgexpr(NULL)
+				{}
+
+				// hash function
+				static
+				ULONG HashValue
+					(
+					const SGExprEntry &gexprentry
+					)
+				{
+					if (NULL == gexprentry.m_pgexpr)
+					{
+						return 0;
+					}
+
+					return CGroupExpression::HashValue(*gexprentry.m_pgexpr);
+				}
+
+				// equality function
+				static
+				BOOL Equals
+					(
+					const SGExprEntry &gexprentryLeft,
+					const SGExprEntry &gexprentryRight
+					)
+				{
+					if (NULL == gexprentryLeft.m_pgexpr || NULL == gexprentryRight.m_pgexpr)
+					{
+						return gexprentryLeft.m_pgexpr == gexprentryRight.m_pgexpr;
+					}
+
+					return CGroupExpression::Equals(*gexprentryLeft.m_pgexpr, *gexprentryRight.m_pgexpr);
+				}
+
+			}; // struct SGExprEntry
+
+			//---------------------------------------------------------------------------
+			//	@class:
+			//		SInsertTask
+			//
+			//	@doc:
+			//		Arguments of a concurrent insertion task
+			//
+			//---------------------------------------------------------------------------
+			template <class HT>
+			struct SInsertTask
+			{
+				// target hash table
+				HT *m_pht;
+
+				// entries to insert, one per group expression
+				SGExprEntry *m_rggexprentry;
+
+				// number of entries
+				ULONG m_ulEntries;
+
+				// entry to start inserting from
+				ULONG m_ulStart;
+
+			}; // struct SInsertTask
+
+			// collect group expressions reachable from the given root group
+			static
+			CGroupExpressionArray *PdrgpgexprCollect(IMemoryPool *mp, CGroup *pgroupRoot);
+
+			// test-and-insert all entries of a task, starting from the task's offset
+			template <class HT, class ACC>
+			static
+			void *PvInsert(void *pv);
+
+			// insert entries from the given number of workers, return elapsed time in ms
+			template <class HT, class ACC>
+			static
+			ULONG UlInsert
+				(
+				IMemoryPool *mp,
+				HT *pht,
+				CGroupExpressionArray *pdrgpgexpr,
+				ULONG ulWorkers
+				);
+
+		public:
+
+			// unittests
+			static GPOS_RESULT EresUnittest();
+			static GPOS_RESULT EresUnittest_ConcurrentInsert();
+
+	}; // class CMemoTest
+}
+
+#endif // !GPOPT_CMemoTest_H
+
+// EOF
@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 
+#include "gpopt/engine/CSchedulerConfig.h"
 #include "gpopt/search/CJobTest.h"
 #include "gpopt/search/CSearchStage.h"
 
@@ -44,7 +45,9 @@ namespace gpopt
 					ULONG ulRounds,
 					ULONG ulFanout,
 					ULONG ulIters,
-					ULONG ulWorkers
+					ULONG ulWorkers,
+					CSchedulerConfig::ESchedulingPolicy esp,
+					CSchedulerConfig::EWorkerPolicy ewp
 #ifdef GPOS_DEBUG
 					,
 					BOOL fTrackingJobs = false
@@ -76,6 +79,13 @@ namespace gpopt
 			static GPOS_RESULT EresUnittest_QueueBasic();
 			static GPOS_RESULT EresUnittest_QueueLight();
 			static GPOS_RESULT EresUnittest_QueueHeavy();
+			static GPOS_RESULT EresUnittest_SpawnWorkStealing();
+			static GPOS_RESULT EresUnittest_QueueWorkStealing();
+			static GPOS_RESULT EresUnittest_SpawnAdaptive();
+			static GPOS_RESULT EresUnittest_QueueAdaptive();
+			static GPOS_RESULT EresUnittest_SpawnPriority();
+			static GPOS_RESULT EresUnittest_QueuePriority();
+			static GPOS_RESULT EresUnittest_SchedulingPolicyScaling();
 			static GPOS_RESULT EresUnittest_BuildMemo();
 			static GPOS_RESULT EresUnittest_BuildMemoLargeJoins();
 
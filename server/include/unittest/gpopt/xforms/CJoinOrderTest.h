@@ -33,11 +33,47 @@ namespace gpopt
 			// counter used to mark last successful test
 			static
 			ULONG m_ulTestCounter;
+
+			// shapes of join graphs
+			enum EJoinGraph
+			{
+				EjgChain = 0,	// each relation joins the next one
+				EjgStar,		// the first relation joins all others
+				EjgClique,		// all relations join each other
+
+				EjgSentinel
+			};
+
+			// generate n-ary join of the given shape
+			static
+			CExpression *PexprNAryJoin(IMemoryPool *mp, EJoinGraph ejg, ULONG ulRels);
+
+			// number of connected subset / connected complement pairs of a join graph
+			static
+			ULONG UlCsgCmpPairs(EJoinGraph ejg, ULONG ulRels);
+
+			// time dynamic programming join ordering of a join graph
+			static
+			void BenchmarkDP(IMemoryPool *mp, EJoinGraph ejg, ULONG ulRels);
+
+			// compare dynamic programming join ordering of a join graph with and
+			// without deriving stats in parallel
+			static
+			void CompareParallelDP(IMemoryPool *mp, EJoinGraph ejg, ULONG ulRels);
+
+			// time all join orders of a join graph with and without sharing
+			// stats of joins among them
+			static
+			void BenchmarkStatsCache(IMemoryPool *mp, EJoinGraph ejg, ULONG ulRels);
+
 		public:
 		
 			// unittests
 			static GPOS_RESULT EresUnittest();
 			static GPOS_RESULT EresUnittest_ExpandMinCard();
+			static GPOS_RESULT EresUnittest_ExpandDP();
+			static GPOS_RESULT EresUnittest_ExpandDPParallel();
+			static GPOS_RESULT EresUnittest_StatsCache();
 			static GPOS_RESULT EresUnittest_RunTests();
 
 	}; // class CJoinOrderTest